@@ -204,6 +204,21 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as 32-bit floats
+    ///
+    /// The samples are normalized to the range [-1, 1]. Formats
+    /// that store more than 16 bits per sample are decoded
+    /// without losing precision.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
@@ -84,14 +84,16 @@ public:
     /// streamed continuously, the file must remain accessible until
     /// the sf::Music object loads a new music or is destroyed.
     ///
-    /// \param filename Path of the music file to open
+    /// \param filename     Path of the music file to open
+    /// \param sampleFormat Format in which the samples are decoded and streamed
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see openFromMemory, openFromStream
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename);
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename,
+                                    SampleFormat                 sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open a music from an audio file in memory
@@ -106,15 +108,18 @@ public:
     /// the sf::Music object loads a new music or is destroyed. That is,
     /// you can't deallocate the buffer right after calling this function.
     ///
-    /// \param data        Pointer to the file data in memory
-    /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param data         Pointer to the file data in memory
+    /// \param sizeInBytes  Size of the data to load, in bytes
+    /// \param sampleFormat Format in which the samples are decoded and streamed
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see openFromFile, openFromStream
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromMemory(const void* data, std::size_t sizeInBytes);
+    [[nodiscard]] bool openFromMemory(const void*  data,
+                                      std::size_t  sizeInBytes,
+                                      SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open a music from an audio file in a custom stream
@@ -128,14 +133,15 @@ public:
     /// streamed continuously, the \a stream must remain accessible
     /// until the sf::Music object loads a new music or is destroyed.
     ///
-    /// \param stream Source stream to read from
+    /// \param stream       Source stream to read from
+    /// \param sampleFormat Format in which the samples are decoded and streamed
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see openFromFile, openFromMemory
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromStream(InputStream& stream);
+    [[nodiscard]] bool openFromStream(InputStream& stream, SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Get the total duration of the music
@@ -222,8 +228,10 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new music
     ///
+    /// \param sampleFormat Format in which the samples are decoded and streamed
+    ///
     ////////////////////////////////////////////////////////////
-    void initialize();
+    void initialize(SampleFormat sampleFormat);
 
     ////////////////////////////////////////////////////////////
     /// \brief Helper to convert an sf::Time to a sample position
@@ -248,10 +256,11 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    InputSoundFile            m_file;     //!< The streamed music file
-    std::vector<std::int16_t> m_samples;  //!< Temporary buffer of samples
-    std::recursive_mutex      m_mutex;    //!< Mutex protecting the data
-    Span<std::uint64_t>       m_loopSpan; //!< Loop Range Specifier
+    InputSoundFile            m_file;         //!< The streamed music file
+    std::vector<std::int16_t> m_samples;      //!< Temporary buffer of samples
+    std::vector<float>        m_floatSamples; //!< Temporary buffer of samples, when streaming 32-bit floats
+    std::recursive_mutex      m_mutex;        //!< Mutex protecting the data
+    Span<std::uint64_t>       m_loopSpan;     //!< Loop Range Specifier
 };
 
 } // namespace sf
@@ -0,0 +1,46 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \ingroup audio
+/// \brief Types of audio samples that can be stored and streamed
+///
+/// 16-bit integers are the most compact representation,
+/// while 32-bit floats keep the full precision of the
+/// decoded audio and are the format used internally by
+/// the audio engine, so they don't need to be converted
+/// before being mixed or processed by effects.
+///
+////////////////////////////////////////////////////////////
+enum class SampleFormat
+{
+    Int16,  //!< Signed 16-bit integers, in the range [-32768, 32767]
+    Float32 //!< 32-bit floating point numbers, normalized to the range [-1, 1]
+};
+
+} // namespace sf
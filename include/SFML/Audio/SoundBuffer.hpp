@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 
 #include <SFML/System/Time.hpp>
@@ -55,6 +56,16 @@ class InputStream;
 class SFML_AUDIO_API SoundBuffer
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Ways of storing the audio data of a sound buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class StorageMode
+    {
+        Decoded,   //!< All the samples are decoded when loading and kept in memory
+        Compressed //!< The encoded file is kept in memory and decoded on demand by each playing sound
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
     ///
@@ -75,14 +86,17 @@ public:
     /// See the documentation of sf::InputSoundFile for the list
     /// of supported formats.
     ///
-    /// \param filename Path of the sound file to load
+    /// \param filename     Path of the sound file to load
+    /// \param sampleFormat Format in which the samples are stored in the buffer
     ///
     /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
     ///
     /// \see loadFromMemory, loadFromStream, loadFromSamples, saveToFile
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::optional<SoundBuffer> loadFromFile(const std::filesystem::path& filename);
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromFile(
+        const std::filesystem::path& filename,
+        SampleFormat                 sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from a file in memory
@@ -90,15 +104,18 @@ public:
     /// See the documentation of sf::InputSoundFile for the list
     /// of supported formats.
     ///
-    /// \param data        Pointer to the file data in memory
-    /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param data         Pointer to the file data in memory
+    /// \param sizeInBytes  Size of the data to load, in bytes
+    /// \param sampleFormat Format in which the samples are stored in the buffer
     ///
     /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
     ///
     /// \see loadFromFile, loadFromStream, loadFromSamples
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::optional<SoundBuffer> loadFromMemory(const void* data, std::size_t sizeInBytes);
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromMemory(const void*  data,
+                                                                   std::size_t  sizeInBytes,
+                                                                   SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from a custom stream
@@ -106,14 +123,16 @@ public:
     /// See the documentation of sf::InputSoundFile for the list
     /// of supported formats.
     ///
-    /// \param stream Source stream to read from
+    /// \param stream       Source stream to read from
+    /// \param sampleFormat Format in which the samples are stored in the buffer
     ///
     /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
     ///
     /// \see loadFromFile, loadFromMemory, loadFromSamples
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::optional<SoundBuffer> loadFromStream(InputStream& stream);
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromStream(InputStream& stream,
+                                                                   SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from an array of audio samples
@@ -138,11 +157,105 @@ public:
         unsigned int                     sampleRate,
         const std::vector<SoundChannel>& channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from an array of 32-bit float audio samples
+    ///
+    /// The samples are expected to be normalized to the range [-1, 1].
+    /// They are stored as they are, and the buffer's sample format
+    /// is sf::SampleFormat::Float32.
+    ///
+    /// \param samples      Pointer to the array of samples in memory
+    /// \param sampleCount  Number of samples in the array
+    /// \param channelCount Number of channels (1 = mono, 2 = stereo, ...)
+    /// \param sampleRate   Sample rate (number of samples to play per second)
+    /// \param channelMap   Map of position in sample frame to sound channel
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadFromFile, loadFromMemory, saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromSamples(
+        const float*                     samples,
+        std::uint64_t                    sampleCount,
+        unsigned int                     channelCount,
+        unsigned int                     sampleRate,
+        const std::vector<SoundChannel>& channelMap);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from a file, keeping it compressed in memory
+    ///
+    /// The content of the file is kept as it is, and only its first
+    /// \a prefixDuration is decoded when loading. Each sf::Sound
+    /// playing the buffer starts from this decoded prefix and then
+    /// decodes the rest of the file on its own, while playing.
+    ///
+    /// See the documentation of sf::InputSoundFile for the list
+    /// of supported formats.
+    ///
+    /// \param filename       Path of the sound file to load
+    /// \param prefixDuration Duration of the beginning of the sound to keep decoded
+    /// \param sampleFormat   Format in which the samples are decoded
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadCompressedFromMemory, loadCompressedFromStream, getStorageMode
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<SoundBuffer> loadCompressedFromFile(
+        const std::filesystem::path& filename,
+        Time                         prefixDuration = milliseconds(100),
+        SampleFormat                 sampleFormat   = SampleFormat::Int16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from a file in memory, keeping it compressed
+    ///
+    /// The file data is copied, so the memory doesn't need
+    /// to stay valid after this function returns.
+    /// See loadCompressedFromFile() for details.
+    ///
+    /// \param data           Pointer to the file data in memory
+    /// \param sizeInBytes    Size of the data to load, in bytes
+    /// \param prefixDuration Duration of the beginning of the sound to keep decoded
+    /// \param sampleFormat   Format in which the samples are decoded
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadCompressedFromFile, loadCompressedFromStream, getStorageMode
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<SoundBuffer> loadCompressedFromMemory(
+        const void*  data,
+        std::size_t  sizeInBytes,
+        Time         prefixDuration = milliseconds(100),
+        SampleFormat sampleFormat   = SampleFormat::Int16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from a custom stream, keeping it compressed in memory
+    ///
+    /// The whole content of the stream is read and copied.
+    /// See loadCompressedFromFile() for details.
+    ///
+    /// \param stream         Source stream to read from
+    /// \param prefixDuration Duration of the beginning of the sound to keep decoded
+    /// \param sampleFormat   Format in which the samples are decoded
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadCompressedFromFile, loadCompressedFromMemory, getStorageMode
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<SoundBuffer> loadCompressedFromStream(
+        InputStream& stream,
+        Time         prefixDuration = milliseconds(100),
+        SampleFormat sampleFormat   = SampleFormat::Int16);
+
     ////////////////////////////////////////////////////////////
     /// \brief Save the sound buffer to an audio file
     ///
     /// See the documentation of sf::OutputSoundFile for the list
-    /// of supported formats.
+    /// of supported formats. Float samples are converted to
+    /// 16-bit integers when they are written.
     ///
     /// \param filename Path of the sound file to write
     ///
@@ -153,29 +266,90 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool saveToFile(const std::filesystem::path& filename) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the samples stored in the buffer
+    ///
+    /// \return Sample format
+    ///
+    /// \see getSamples, getFloatSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    SampleFormat getSampleFormat() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the way the audio data is stored in the buffer
+    ///
+    /// \return Storage mode
+    ///
+    /// \see loadCompressedFromFile, getMemoryUsage
+    ///
+    ////////////////////////////////////////////////////////////
+    StorageMode getStorageMode() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the amount of memory used by the audio data of the buffer
+    ///
+    /// This accounts for the decoded samples and, for compressed
+    /// buffers, the encoded file data. It can be used to choose
+    /// the storage mode of each asset.
+    ///
+    /// It doesn't include the decoders of the sounds playing a
+    /// compressed buffer: each of them holds the state of its own
+    /// decoder (from a few to a few hundred kilobytes, depending
+    /// on the format) from play() until it is stopped, its buffer
+    /// is changed or it is destroyed.
+    ///
+    /// \return Memory used by the audio data, in bytes
+    ///
+    /// \see getStorageMode
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getMemoryUsage() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the array of audio samples stored in the buffer
     ///
     /// The format of the returned samples is 16 bits signed integer.
     /// The total number of samples in this array is given by the
     /// getSampleCount() function.
+    /// If the buffer stores 32-bit float samples, this function
+    /// returns a null pointer; use getFloatSamples() instead.
+    /// It also returns a null pointer for compressed buffers,
+    /// which don't hold all their samples.
     ///
     /// \return Read-only pointer to the array of sound samples
     ///
-    /// \see getSampleCount
+    /// \see getSampleCount, getSampleFormat
     ///
     ////////////////////////////////////////////////////////////
     const std::int16_t* getSamples() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the array of 32-bit float audio samples stored in the buffer
+    ///
+    /// The total number of samples in this array is given by the
+    /// getSampleCount() function.
+    /// If the buffer stores 16-bit samples, this function
+    /// returns a null pointer; use getSamples() instead.
+    /// It also returns a null pointer for compressed buffers,
+    /// which don't hold all their samples.
+    ///
+    /// \return Read-only pointer to the array of sound samples
+    ///
+    /// \see getSampleCount, getSampleFormat
+    ///
+    ////////////////////////////////////////////////////////////
+    const float* getFloatSamples() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the number of samples stored in the buffer
     ///
     /// The array of samples can be accessed with the getSamples()
-    /// function.
+    /// or getFloatSamples() function, depending on the sample format.
     ///
     /// \return Number of samples
     ///
-    /// \see getSamples
+    /// \see getSamples, getFloatSamples
     ///
     ////////////////////////////////////////////////////////////
     std::uint64_t getSampleCount() const;
@@ -249,15 +423,36 @@ private:
     ////////////////////////////////////////////////////////////
     explicit SoundBuffer(std::vector<std::int16_t>&& samples);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from vector of 32-bit float samples
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoundBuffer(std::vector<float>&& samples);
+
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new sound
     ///
-    /// \param file Sound file providing access to the new loaded sound
+    /// \param file         Sound file providing access to the new loaded sound
+    /// \param sampleFormat Format in which the samples are stored in the buffer
     ///
     /// \return True on successful initialization, false on failure
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::optional<SoundBuffer> initialize(InputSoundFile& file);
+    [[nodiscard]] static std::optional<SoundBuffer> initialize(InputSoundFile& file, SampleFormat sampleFormat);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Initialize a compressed buffer from the content of a sound file
+    ///
+    /// \param data           Content of the sound file
+    /// \param prefixDuration Duration of the beginning of the sound to decode
+    /// \param sampleFormat   Format in which the samples are decoded
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<SoundBuffer> initializeCompressed(std::vector<std::byte>&& data,
+                                                                         Time                     prefixDuration,
+                                                                         SampleFormat             sampleFormat);
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the internal buffer with the cached audio samples
@@ -295,7 +490,12 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::int16_t> m_samples;                        //!< Samples buffer
+    std::vector<std::int16_t> m_samples;                        //!< Samples buffer (decoded prefix, when compressed)
+    std::vector<float>        m_floatSamples;                   //!< Samples buffer, when storing 32-bit floats
+    SampleFormat              m_sampleFormat{};                 //!< Format of the stored samples
+    StorageMode               m_storageMode{};                  //!< Way the audio data is stored
+    std::vector<std::byte>    m_compressedData;                 //!< Content of the sound file, when compressed
+    std::uint64_t             m_compressedSampleCount{};        //!< Total number of samples, when compressed
     unsigned int              m_sampleRate{44100};              //!< Number of samples per second
     std::vector<SoundChannel> m_channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
     Time                      m_duration;                       //!< Sound duration
@@ -323,6 +523,25 @@ private:
 /// a custom stream (see sf::InputStream) or directly from an array
 /// of samples. It can also be saved back to a file.
 ///
+/// Samples are stored as 16-bit integers by default. Passing
+/// sf::SampleFormat::Float32 when loading keeps them as 32-bit
+/// floats instead: this uses twice as much memory, but keeps the
+/// full precision of the decoded file and matches the format used
+/// by the audio engine, so no conversion is needed during playback.
+///
+/// Short sounds are best stored decoded, but a large number of
+/// them can take a lot of memory. The loadCompressedFromFile()
+/// family of functions keeps the encoded file in memory instead,
+/// along with a small decoded prefix so that playback starts
+/// immediately. Each sf::Sound then decodes the rest of the file
+/// while playing, trading CPU time for memory: it opens its own
+/// decoder when it starts playing, and releases it when it is
+/// stopped, its buffer is changed or it is destroyed. A sound
+/// that finishes playing on its own keeps its decoder, to reuse
+/// it if it is played again; call stop() to release it sooner.
+/// getMemoryUsage() reports the memory used by either kind of
+/// buffer.
+///
 /// Sound buffers alone are not very useful: they hold the audio data
 /// but cannot be played. To do so, you need to use the sf::Sound class,
 /// which provides functions to play/pause/stop the sound as well as
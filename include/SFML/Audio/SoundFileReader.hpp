@@ -105,6 +105,23 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] virtual std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as 32-bit floats
+    ///
+    /// The samples are normalized to the range [-1, 1].
+    /// The default implementation calls read() and converts
+    /// the 16-bit samples; readers whose format stores more
+    /// precision than that should override it to return the
+    /// decoded samples directly.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::uint64_t readFloat(float* samples, std::uint64_t maxCount);
 };
 
 } // namespace sf
@@ -157,6 +174,13 @@ public:
 ///         // as 16-bits signed integers in the file
 ///         // return the actual number of samples read
 ///     }
+///
+///     std::uint64_t readFloat(float* samples, std::uint64_t maxCount) override
+///     {
+///         // optional: read up to 'maxCount' samples into the 'samples' array,
+///         // normalized to [-1, 1], without going through 16-bit integers
+///         // return the actual number of samples read
+///     }
 /// };
 ///
 /// sf::SoundFileFactory::registerReader<MySoundFileReader>();
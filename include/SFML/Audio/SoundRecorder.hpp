@@ -227,6 +227,8 @@ protected:
     /// recorded data is available. The derived class can then do
     /// whatever it wants with it (storing it, playing it, sending
     /// it over the network, etc.).
+    /// The samples point directly into the capture device buffer
+    /// and are only valid during the call.
     ///
     /// \param samples     Pointer to the new chunk of recorded samples
     /// \param sampleCount Number of samples pointed by \a samples
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 
@@ -54,11 +55,18 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a chunk of audio data to stream
     ///
+    /// The samples are not copied: they must stay valid until
+    /// the next call to onGetData or onSeek.
+    /// Streams initialized with sf::SampleFormat::Int16 provide
+    /// their samples through \a samples, while streams initialized
+    /// with sf::SampleFormat::Float32 use \a floatSamples.
+    ///
     ////////////////////////////////////////////////////////////
     struct Chunk
     {
-        const std::int16_t* samples{};     //!< Pointer to the audio samples
-        std::size_t         sampleCount{}; //!< Number of samples pointed by Samples
+        const std::int16_t* samples{};      //!< Pointer to the audio samples
+        std::size_t         sampleCount{};  //!< Number of samples pointed by Samples
+        const float*        floatSamples{}; //!< Pointer to the audio samples, for 32-bit float streams
     };
 
     ////////////////////////////////////////////////////////////
@@ -136,6 +144,14 @@ public:
     ////////////////////////////////////////////////////////////
     std::vector<SoundChannel> getChannelMap() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the samples provided by the stream
+    ///
+    /// \return Sample format
+    ///
+    ////////////////////////////////////////////////////////////
+    SampleFormat getSampleFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the current status of the stream (stopped, paused, playing)
     ///
@@ -194,6 +210,57 @@ public:
     ////////////////////////////////////////////////////////////
     bool getLoop() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable decoding ahead of playback
+    ///
+    /// When enabled, a background thread calls onGetData and
+    /// onSeek to keep a ring buffer of up to \a duration of
+    /// decoded audio, and the audio thread only copies samples
+    /// out of it. This keeps decoding, and the locks and
+    /// allocations it may involve, out of the real-time audio
+    /// callback at the cost of a little memory and latency
+    /// when seeking.
+    /// Pass sf::Time::Zero to disable it (this is the default).
+    /// The setting takes effect the next time the stream is
+    /// started from the stopped state.
+    ///
+    /// When this mode is used, derived classes must call stop()
+    /// in their destructor, so that the decoder thread no longer
+    /// calls their virtual functions once they are destroyed.
+    ///
+    /// \param duration Amount of audio to decode ahead
+    ///
+    /// \see getDecodeAhead, getUnderrunCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDecodeAhead(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the amount of audio decoded ahead of playback
+    ///
+    /// \return Decode-ahead duration, sf::Time::Zero if disabled
+    ///
+    /// \see setDecodeAhead
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getDecodeAhead() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of buffer underruns
+    ///
+    /// An underrun happens when the audio thread needs samples
+    /// that the decoder thread has not produced yet; the missing
+    /// samples are replaced with silence. The counter is only
+    /// updated in decode-ahead mode and is reset every time the
+    /// stream is started from the stopped state.
+    ///
+    /// \return Number of audio callbacks that had to be padded with silence
+    ///
+    /// \see setDecodeAhead
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getUnderrunCount() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the effect processor to be applied to the sound
     ///
@@ -224,12 +291,19 @@ protected:
     /// It can be called multiple times if the settings of the
     /// audio stream change, but only when the stream is stopped.
     ///
+    /// Streams using sf::SampleFormat::Float32 skip the conversion
+    /// that the audio engine otherwise applies to 16-bit samples.
+    ///
     /// \param channelCount Number of channels of the stream
     /// \param sampleRate   Sample rate, in samples per second
     /// \param channelMap   Map of position in sample frame to sound channel
+    /// \param sampleFormat Format of the samples returned by onGetData
     ///
     ////////////////////////////////////////////////////////////
-    void initialize(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap);
+    void initialize(unsigned int                     channelCount,
+                    unsigned int                     sampleRate,
+                    const std::vector<SoundChannel>& channelMap,
+                    SampleFormat                     sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Request a new chunk of audio samples from the stream source
@@ -243,6 +317,10 @@ protected:
     /// the returned array of samples is not empty; this would stop the stream
     /// due to an internal limitation.
     ///
+    /// The samples of \a data are not copied by the stream: they must
+    /// remain valid until the next call to onGetData or onSeek, so
+    /// they usually live in a member buffer of the derived class.
+    ///
     /// \param data Chunk of data to fill
     ///
     /// \return True to continue playback, false to stop
@@ -324,6 +402,22 @@ private:
 /// It is important to keep this in mind, because you may have to take
 /// care of synchronization issues if you share data between threads.
 ///
+/// By default, onGetData is called directly from the audio thread,
+/// so it must return quickly. Streams whose source is expensive to
+/// read (e.g. compressed files) can call setDecodeAhead to move
+/// decoding to a background thread that stays ahead of playback.
+///
+/// The default synchronous mode is neither lock-free nor
+/// allocation-free: whatever onGetData does runs on the audio
+/// thread. sf::Music, for instance, locks its mutex and decodes
+/// the file there. Only the decode-ahead mode keeps the audio
+/// callback free of locks and allocations.
+///
+/// The stream doesn't copy the samples returned by onGetData,
+/// it reads them in place until the next call to onGetData or
+/// onSeek. The derived class must therefore keep them alive
+/// until then, and must not point the chunk to a local buffer.
+///
 /// Usage example:
 /// \code
 /// class CustomStream : public sf::SoundStream
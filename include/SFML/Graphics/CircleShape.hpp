@@ -33,6 +33,9 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <memory>
+#include <vector>
+
 #include <cstddef>
 
 
@@ -125,8 +128,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    float       m_radius;     //!< Radius of the circle
-    std::size_t m_pointCount; //!< Number of points composing the circle
+    float                                        m_radius;     //!< Radius of the circle
+    std::size_t                                  m_pointCount; //!< Number of points composing the circle
+    std::shared_ptr<const std::vector<Vector2f>> m_unitPoints; //!< Points of the unit circle, shared between circles
 };
 
 } // namespace sf
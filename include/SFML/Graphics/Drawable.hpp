@@ -29,6 +29,10 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.hpp>
 
+#include <SFML/Graphics/Rect.hpp>
+
+#include <optional>
+
 
 namespace sf
 {
@@ -64,6 +68,25 @@ protected:
     ///
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, RenderStates states) const = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the object
+    ///
+    /// When culling is enabled on a render target, objects whose
+    /// bounds lie entirely outside of its visible area are not
+    /// drawn. The bounds are expressed in the coordinate system
+    /// of the render states passed to draw, and must contain
+    /// everything that the object draws.
+    ///
+    /// The default implementation returns std::nullopt, which
+    /// means that the object is never culled.
+    ///
+    /// \return Bounding rectangle of the object, or std::nullopt if it cannot be culled
+    ///
+    /// \see RenderTarget::setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual std::optional<FloatRect> getCullingBounds() const;
 };
 
 } // namespace sf
@@ -77,7 +100,10 @@ protected:
 /// of derived classes to be drawn to a sf::RenderTarget.
 ///
 /// All you have to do in your derived class is to override the
-/// draw virtual function.
+/// draw virtual function. Classes that can cheaply compute their
+/// bounds may also override getCullingBounds, so that they are
+/// skipped when they are out of view and culling is enabled on
+/// the render target.
 ///
 /// Note that inheriting from sf::Drawable is not mandatory,
 /// but it allows this nice syntax "window.draw(object)" rather
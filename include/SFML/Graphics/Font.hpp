@@ -35,11 +35,14 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <array>
+#include <deque>
 #include <filesystem>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <cstddef>
@@ -56,6 +59,7 @@ class ResourceStream;
 namespace sf
 {
 class InputStream;
+class Shader;
 
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading and manipulating character fonts
@@ -73,6 +77,18 @@ public:
         std::string family; //!< The font family
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the glyph atlas of a character size
+    ///
+    ////////////////////////////////////////////////////////////
+    struct AtlasStats
+    {
+        Vector2u    size;            //!< Current size of the atlas texture, in pixels
+        float       occupancy{};     //!< Ratio of the atlas area allocated to glyphs, in range [0, 1]
+        std::size_t glyphCount{};    //!< Number of glyphs currently stored in the atlas
+        std::size_t evictionCount{}; //!< Number of glyphs evicted so far to make room for new ones
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Load the font from a file
     ///
@@ -160,6 +176,14 @@ public:
     /// Be aware that using a negative value for the outline
     /// thickness will cause distorted rendering.
     ///
+    /// \warning The returned reference is only valid until the
+    /// next glyph is loaded into the font (by this function,
+    /// getDistanceFieldGlyph or when drawing a sf::Text). Loading
+    /// a glyph may grow the glyph storage, or evict the least
+    /// recently used glyphs once the atlas reaches its maximum
+    /// size (see setMaximumAtlasSize). Copy the glyph if you
+    /// need to keep it.
+    ///
     /// \param codePoint        Unicode code point of the character to get
     /// \param characterSize    Reference character size
     /// \param bold             Retrieve the bold version or the regular one?
@@ -188,6 +212,37 @@ public:
     ////////////////////////////////////////////////////////////
     bool hasGlyph(std::uint32_t codePoint) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load ranges of glyphs into the cache ahead of time
+    ///
+    /// Loading a glyph the first time it is requested by \ref getGlyph
+    /// can cause visible hitches when a lot of new characters appear
+    /// at once (a new language or a new character size for example).
+    /// This function rasterizes the requested glyphs in parallel on
+    /// worker threads, then packs them in the texture of the page and
+    /// uploads them with a few texture updates. Glyphs which are
+    /// already in the cache are skipped.
+    ///
+    /// Each range is inclusive, e.g. `{0x20, 0x7E}` for printable ASCII.
+    /// The function blocks until all the glyphs are available, and
+    /// must be called from the thread which uses the font.
+    ///
+    /// Fonts loaded from a stream are rasterized on the calling
+    /// thread only, since the stream can't be shared between threads.
+    ///
+    /// \param codePointRanges  Ranges of Unicode code points to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    ///
+    /// \see getGlyph
+    ///
+    ////////////////////////////////////////////////////////////
+    void preloadGlyphs(const std::vector<std::pair<std::uint32_t, std::uint32_t>>& codePointRanges,
+                       unsigned int                                               characterSize,
+                       bool                                                       bold,
+                       float                                                      outlineThickness = 0) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the kerning offset of two glyphs
     ///
@@ -262,6 +317,109 @@ public:
     ////////////////////////////////////////////////////////////
     const Texture& getTexture(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a glyph rendered as a signed distance field
+    ///
+    /// Distance field glyphs are rasterized once, at the size
+    /// returned by getDistanceFieldSize, into a single atlas
+    /// shared by all character sizes. Instead of coverage, each
+    /// texel of the atlas stores in its alpha channel the signed
+    /// distance to the outline of the glyph: 0.5 on the outline,
+    /// higher values inside, lower values outside. This lets
+    /// sf::Text draw the glyph at any size with a distance field
+    /// shader, and add an outline without rasterizing the glyph
+    /// again.
+    ///
+    /// The metrics of the returned glyph are expressed at the
+    /// distance field size. Its texture rectangle covers the
+    /// glyph itself; the atlas contains getDistanceFieldSpread()
+    /// more texels of distance field on each side of it.
+    ///
+    /// \warning As with getGlyph, the returned reference is only
+    /// valid until the next glyph is loaded into the font.
+    ///
+    /// \param codePoint Unicode code point of the character to get
+    /// \param bold      Retrieve the bold version or the regular one?
+    ///
+    /// \return The distance field glyph corresponding to \a codePoint
+    ///
+    /// \see getDistanceFieldTexture, getDistanceFieldSize
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& getDistanceFieldGlyph(std::uint32_t codePoint, bool bold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the kerning offset of two distance field glyphs
+    ///
+    /// This is the equivalent of getKerning at the distance field
+    /// size, computed from the distance field glyphs so that no
+    /// regular glyph needs to be rasterized at that size.
+    ///
+    /// \param first  Unicode code point of the first character
+    /// \param second Unicode code point of the second character
+    /// \param bold   Retrieve the bold version or the regular one?
+    ///
+    /// \return Kerning value for \a first and \a second, in pixels at the distance field size
+    ///
+    /// \see getDistanceFieldGlyph, getKerning
+    ///
+    ////////////////////////////////////////////////////////////
+    float getDistanceFieldKerning(std::uint32_t first, std::uint32_t second, bool bold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the texture containing the distance field glyphs
+    ///
+    /// The contents of the returned texture changes as more glyphs
+    /// are requested, thus it is not very relevant. It is mainly
+    /// used internally by sf::Text.
+    ///
+    /// \return Texture containing the distance field glyphs
+    ///
+    /// \see getDistanceFieldGlyph
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getDistanceFieldTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size at which distance field glyphs are rasterized
+    ///
+    /// Larger sizes preserve more details of the glyphs, such as
+    /// sharp corners, at the expense of a larger atlas.
+    /// Changing the size discards the distance field glyphs
+    /// loaded so far. The default size is 64.
+    ///
+    /// \param size Character size of the distance field glyphs, in pixels
+    ///
+    /// \see getDistanceFieldSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDistanceFieldSize(unsigned int size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size at which distance field glyphs are rasterized
+    ///
+    /// \return Character size of the distance field glyphs, in pixels
+    ///
+    /// \see setDistanceFieldSize
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getDistanceFieldSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the range covered by the distance fields around the glyphs
+    ///
+    /// The distance field extends this number of texels on each
+    /// side of the outline of a glyph; it is 1/8 of the distance
+    /// field size. This is also the maximum outline thickness
+    /// that can be drawn from the distance field, at that size.
+    ///
+    /// \return Range of the distance fields, in texels
+    ///
+    /// \see getDistanceFieldSize
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getDistanceFieldSpread() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable the smooth filter
     ///
@@ -288,7 +446,98 @@ public:
     ////////////////////////////////////////////////////////////
     bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable alpha-only glyph atlases
+    ///
+    /// Glyphs are white with varying alpha, so their pages can
+    /// be stored in textures having a single alpha channel. These
+    /// use a quarter of the memory of regular RGBA textures, and
+    /// new glyphs are uploaded with a quarter of the bytes.
+    /// This is especially useful for fonts with a lot of glyphs,
+    /// like CJK fonts.
+    ///
+    /// Texts are rendered identically with both kinds of atlas.
+    /// Shaders applied to texts read white pixels from alpha-only
+    /// atlases only if texture swizzling is supported (OpenGL 3.3
+    /// or ARB_texture_swizzle), and black pixels otherwise.
+    /// Alpha-only atlases are not available with OpenGL ES, where
+    /// this setting has no effect.
+    ///
+    /// Changing this setting discards all the glyphs loaded so far.
+    /// Alpha-only atlases are disabled by default.
+    ///
+    /// \param alphaOnly True to store glyphs in alpha-only textures
+    ///
+    /// \see isAlphaOnlyAtlas
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAlphaOnlyAtlas(bool alphaOnly);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether glyphs are stored in alpha-only textures
+    ///
+    /// \return True if alpha-only atlases are enabled
+    ///
+    /// \see setAlphaOnlyAtlas
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isAlphaOnlyAtlas() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum size of the glyph atlases
+    ///
+    /// The atlas texture of each character size starts small
+    /// and grows as glyphs are added, until it reaches this size
+    /// (or the maximum texture size supported by the graphics
+    /// card, whichever is smaller). Once an atlas is full, the
+    /// least recently used glyphs are evicted to make room
+    /// for the new ones.
+    /// The default value, 0, means that atlases are only
+    /// limited by sf::Texture::getMaximumSize().
+    ///
+    /// \param size Maximum width and height of an atlas, in pixels
+    ///
+    /// \see getMaximumAtlasSize, getAtlasStats
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaximumAtlasSize(unsigned int size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum size of the glyph atlases
+    ///
+    /// \return Maximum width and height of an atlas, in pixels, or 0 if unlimited
+    ///
+    /// \see setMaximumAtlasSize
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getMaximumAtlasSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get statistics about the glyph atlas of a character size
+    ///
+    /// These values can be used to tune the maximum atlas size
+    /// (see setMaximumAtlasSize) for a given set of texts.
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Statistics about the atlas of \a characterSize
+    ///
+    ////////////////////////////////////////////////////////////
+    AtlasStats getAtlasStats(unsigned int characterSize) const;
+
 private:
+    friend class Text;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Horizontal span of free space within a row
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Span
+    {
+        unsigned int left{};  //!< X position of the span into the texture
+        unsigned int width{}; //!< Width of the span
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a row of glyphs
     ///
@@ -299,15 +548,46 @@ private:
         {
         }
 
-        unsigned int width{}; //!< Current width of the row
-        unsigned int top;     //!< Y position of the row into the texture
-        unsigned int height;  //!< Height of the row
+        unsigned int      width{};   //!< Current width of the row
+        unsigned int      top;       //!< Y position of the row into the texture
+        unsigned int      height;    //!< Height of the row
+        std::vector<Span> freeSpans; //!< Spans reclaimed from evicted glyphs, sorted by position
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Glyph stored in a page, along with its cache information
+    ///
+    ////////////////////////////////////////////////////////////
+    struct GlyphSlot
+    {
+        Glyph         glyph;      //!< The glyph
+        std::uint64_t key{};      //!< Key of the glyph in the glyph table
+        IntRect       allocation; //!< Rectangle allocated in the texture, including padding
+        std::uint64_t lastUse{};  //!< Value of the page's use counter when the glyph was last requested
+        bool          used{};     //!< Does the slot hold a glyph?
     };
 
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    using GlyphTable   = std::unordered_map<std::uint64_t, std::size_t>; //!< Table mapping a glyph key to its slot
+    using KerningTable = std::unordered_map<std::uint64_t, float>;       //!< Table mapping code point pairs to kernings
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Direct lookup table for the code points of the Basic Multilingual Plane
+    ///
+    /// Code points are split into blocks of 256 which are only
+    /// allocated once a code point of the block is requested.
+    /// Each entry holds the slot of the glyph in the page plus one,
+    /// zero meaning that the glyph hasn't been looked up yet.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct GlyphLookupTable
+    {
+        float                                       outlineThickness{}; //!< Outline thickness of the glyphs
+        bool                                        bold{};             //!< Boldness of the glyphs
+        std::array<std::vector<std::uint32_t>, 256> blocks;             //!< Blocks of 256 code points
+    };
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
@@ -315,12 +595,20 @@ private:
     ////////////////////////////////////////////////////////////
     struct Page
     {
-        explicit Page(bool smooth);
-
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-        Texture          texture;    //!< Texture containing the pixels of the glyphs
-        unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+        Page(bool smooth, bool alphaOnly, unsigned int pageSpread = 0);
+
+        std::deque<GlyphSlot>         glyphs;          //!< Loaded glyphs, stored in slots that never move
+        std::vector<std::size_t>      freeSlots;       //!< Slots of evicted glyphs, available for new glyphs
+        GlyphTable                    glyphSlots;      //!< Table mapping glyph keys to their slot in the glyphs storage
+        std::vector<GlyphLookupTable> lookupTables;    //!< Direct lookup tables, one per boldness/outline combination
+        std::array<KerningTable, 2>   kernings;        //!< Kerning cache for regular and bold glyphs
+        Texture                       texture;         //!< Texture containing the pixels of the glyphs
+        unsigned int                  nextRow{3};      //!< Y position of the next new row in the texture
+        std::vector<Row>              rows;            //!< List containing the position of all the existing rows
+        std::uint64_t                 useCounter{};    //!< Counter incremented every time a glyph is requested
+        std::size_t                   allocatedArea{}; //!< Texture area allocated to glyphs, in pixels
+        std::size_t                   evictionCount{}; //!< Number of glyphs evicted so far
+        unsigned int                  spread{};        //!< Range of the distance fields, 0 if the page holds bitmaps
     };
 
     ////////////////////////////////////////////////////////////
@@ -334,8 +622,53 @@ private:
     Page& loadPage(unsigned int characterSize) const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Load a new glyph and store it in the cache
+    /// \brief Find or create the page of the distance field glyphs
+    ///
+    /// \return The distance field glyphs page
+    ///
+    ////////////////////////////////////////////////////////////
+    Page& loadDistanceFieldPage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the kerning offset of two glyphs of a page, caching it in the page
     ///
+    /// \param page          Page of glyphs providing the compensation deltas
+    /// \param first         Unicode code point of the first character
+    /// \param second        Unicode code point of the second character
+    /// \param characterSize Character size at which the page's glyphs are rasterized
+    /// \param bold          Use the bold version or the regular one?
+    ///
+    /// \return Kerning value for \a first and \a second, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    float findKerning(Page&         page,
+                      std::uint32_t first,
+                      std::uint32_t second,
+                      unsigned int  characterSize,
+                      bool          bold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a glyph from a page, loading it if needed
+    ///
+    /// \param page             Page of glyphs to search in
+    /// \param codePoint        Unicode code point of the character to get
+    /// \param characterSize    Character size at which the page's glyphs are rasterized
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    ///
+    /// \return The glyph corresponding to \a codePoint
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& findGlyph(Page&         page,
+                           std::uint32_t codePoint,
+                           unsigned int  characterSize,
+                           bool          bold,
+                           float         outlineThickness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a new glyph into the texture of a page
+    ///
+    /// \param page             Page of glyphs to load the glyph into
     /// \param codePoint        Unicode code point of the character to load
     /// \param characterSize    Reference character size
     /// \param bold             Retrieve the bold version or the regular one?
@@ -344,7 +677,34 @@ private:
     /// \return The glyph corresponding to \a codePoint and \a characterSize
     ///
     ////////////////////////////////////////////////////////////
-    Glyph loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
+    Glyph loadGlyph(Page&         page,
+                    std::uint32_t codePoint,
+                    unsigned int  characterSize,
+                    bool          bold,
+                    float         outlineThickness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader drawing distance field glyphs
+    ///
+    /// The shader is compiled the first time it is requested.
+    /// It is mainly for internal use by sf::Text.
+    ///
+    /// \return The distance field shader, or a null pointer if shaders are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    Shader* getDistanceFieldShader() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store a loaded glyph in the cache of a page
+    ///
+    /// \param page  Page of glyphs to store the glyph in
+    /// \param key   Key identifying the glyph in the page
+    /// \param glyph Glyph to store
+    ///
+    /// \return Index of the slot holding the glyph in the page
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addGlyph(Page& page, std::uint64_t key, const Glyph& glyph) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
@@ -357,6 +717,30 @@ private:
     ////////////////////////////////////////////////////////////
     IntRect findGlyphRect(Page& page, const Vector2u& size) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate a rectangle for a glyph in the rows of a page
+    ///
+    /// The texture of the page is grown if needed, up to \a maximumSize.
+    ///
+    /// \param page        Page of glyphs to search in
+    /// \param size        Width and height of the rectangle
+    /// \param maximumSize Maximum width and height of the texture
+    ///
+    /// \return Allocated rectangle, or std::nullopt if the page is full
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<IntRect> allocateGlyphRect(Page& page, const Vector2u& size, unsigned int maximumSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict the least recently used glyphs of a page
+    ///
+    /// \param page Page of glyphs to evict glyphs from
+    ///
+    /// \return True if some space was reclaimed, false if there was nothing to evict
+    ///
+    ////////////////////////////////////////////////////////////
+    bool evictGlyphs(Page& page) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
     ///
@@ -382,10 +766,16 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::shared_ptr<FontHandles> m_fontHandles;    //!< Shared information about the internal font instance
-    bool                         m_isSmooth{true}; //!< Status of the smooth filter
-    Info                         m_info;           //!< Information about the font
-    mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
+    std::shared_ptr<FontHandles>    m_fontHandles;           //!< Shared information about the internal font instance
+    bool                            m_isSmooth{true};        //!< Status of the smooth filter
+    bool                            m_isAlphaOnlyAtlas{};    //!< Do the pages store glyphs in alpha-only textures?
+    unsigned int                    m_maximumAtlasSize{};    //!< Maximum size of the atlases, 0 if unlimited
+    unsigned int                    m_distanceFieldSize{64}; //!< Character size of the distance field glyphs
+    Info                            m_info;                  //!< Information about the font
+    mutable PageTable               m_pages;                 //!< Table containing the glyphs pages by character size
+    mutable std::optional<Page>     m_distanceFieldPage;     //!< Page containing the distance field glyphs
+    mutable std::shared_ptr<Shader> m_distanceFieldShader;   //!< Shader drawing distance field glyphs
+    mutable bool                    m_shaderLoadAttempted{}; //!< Was compiling the distance field shader attempted?
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
 #ifdef SFML_SYSTEM_ANDROID
     std::shared_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
@@ -35,6 +35,7 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <filesystem>
+#include <iosfwd>
 #include <optional>
 #include <string_view>
 #include <vector>
@@ -281,12 +282,56 @@ public:
     void flipVertically();
 
 private:
+    friend class ImageLoader;
+
     ////////////////////////////////////////////////////////////
     /// \brief Directly initialize data members
     ///
     ////////////////////////////////////////////////////////////
     Image(Vector2u size, std::vector<std::uint8_t>&& pixels);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the image from a file on disk
+    ///
+    /// This function is mainly for internal use by sf::ImageLoader,
+    /// whose worker threads can't write to sf::err() concurrently.
+    ///
+    /// \param filename    Path of the image file to load
+    /// \param errorStream Stream receiving the error messages
+    ///
+    /// \return Image if loading succeeded, `std::nullopt` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Image> loadFromFile(const std::filesystem::path& filename,
+                                                           std::ostream&                errorStream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the image from a file in memory
+    ///
+    /// This function is mainly for internal use by sf::ImageLoader.
+    ///
+    /// \param data        Pointer to the file data in memory
+    /// \param size        Size of the data to load, in bytes
+    /// \param errorStream Stream receiving the error messages
+    ///
+    /// \return Image if loading succeeded, `std::nullopt` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Image> loadFromMemory(const void*   data,
+                                                             std::size_t   size,
+                                                             std::ostream& errorStream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the image from a custom stream
+    ///
+    /// \param stream      Source stream to read from
+    /// \param errorStream Stream receiving the error messages
+    ///
+    /// \return Image if loading succeeded, `std::nullopt` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Image> loadFromStream(InputStream& stream, std::ostream& errorStream);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
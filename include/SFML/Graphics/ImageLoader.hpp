@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Decode images in parallel on a pool of worker threads
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageLoader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// \param threadCount Number of worker threads, 0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ImageLoader(unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for all the pending images to be loaded, then
+    /// stops the worker threads.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ImageLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader(const ImageLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader& operator=(const ImageLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load an image from a file on a worker thread
+    ///
+    /// See Image::loadFromFile for the supported formats.
+    ///
+    /// \param filename Path of the image file to load
+    ///
+    /// \return Future holding the image, or std::nullopt if loading failed
+    ///
+    /// \see loadFromFiles, loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::optional<Image>> loadFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load several images from files on the worker threads
+    ///
+    /// The images are decoded in parallel, in no particular
+    /// order; the futures are returned in the order of
+    /// \a filenames.
+    ///
+    /// \param filenames Paths of the image files to load
+    ///
+    /// \return Futures holding the images, or std::nullopt for the images that failed to load
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<std::future<std::optional<Image>>> loadFromFiles(
+        const std::vector<std::filesystem::path>& filenames);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load an image from a file in memory on a worker thread
+    ///
+    /// The data is not copied: it must remain valid until the
+    /// returned future is ready.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    ///
+    /// \return Future holding the image, or std::nullopt if loading failed
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::optional<Image>> loadFromMemory(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return Number of threads decoding images
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a loading task for the worker threads
+    ///
+    /// \param load Function loading the image
+    ///
+    /// \return Future holding the result of \a load
+    ///
+    ////////////////////////////////////////////////////////////
+    std::future<std::optional<Image>> enqueue(std::function<std::optional<Image>()> load);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    const std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageLoader
+/// \ingroup graphics
+///
+/// Decoding images is CPU intensive, and loading many of
+/// them one after the other on the main thread can make
+/// startup noticeably slow. sf::ImageLoader owns a pool of
+/// worker threads which decode images in parallel, and
+/// hands the results back through std::future objects.
+///
+/// The images are decoded exactly like with
+/// sf::Image::loadFromFile and sf::Image::loadFromMemory.
+/// Textures must still be created on a thread with an
+/// active OpenGL context, typically once the futures are
+/// ready.
+///
+/// Example:
+/// \code
+/// sf::ImageLoader loader;
+///
+/// // Start decoding all the images at once
+/// auto futures = loader.loadFromFiles({"background.png", "player.png", "tiles.png"});
+///
+/// // Upload them to textures as they become ready
+/// std::vector<sf::Texture> textures(futures.size());
+/// for (std::size_t i = 0; i < futures.size(); ++i)
+/// {
+///     const auto image = futures[i].get();
+///     if (!image || !textures[i].loadFromImage(*image))
+///         return -1;
+/// }
+/// \endcode
+///
+/// \see sf::Image, sf::Texture
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,359 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Index buffer storage for indexed drawing of vertices
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API IndexBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// If data is going to be updated once or more every frame,
+    /// set the usage to Stream. If data is going to be set once
+    /// and used for a long time without being modified, set the
+    /// usage to Static. For everything else Dynamic should be a
+    /// good compromise.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Usage
+    {
+        Stream,  //!< Constantly changing data
+        Dynamic, //!< Occasionally changing data
+        Static   //!< Rarely changing data
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of indices
+    ///
+    /// 16-bit indices take half the memory but can only address
+    /// the first 65536 vertices of a vertex buffer.
+    /// 32-bit indices may not be supported with OpenGL ES.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class IndexType
+    {
+        UInt16, //!< 16-bit unsigned indices
+        UInt32  //!< 32-bit unsigned indices
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty index buffer of 16-bit indices.
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an IndexBuffer with a specific index type
+    ///
+    /// Creates an empty index buffer and sets its index type to \p type.
+    ///
+    /// \param type Type of indices
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexBuffer(IndexType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an IndexBuffer with a specific usage specifier
+    ///
+    /// Creates an empty index buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an IndexBuffer with a specific index type and usage specifier
+    ///
+    /// \param type  Type of indices
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(IndexType type, Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(const IndexBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IndexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the index buffer
+    ///
+    /// Creates the index buffer and allocates enough graphics
+    /// memory to hold \p indexCount indices. Any previously
+    /// allocated memory is freed in the process.
+    ///
+    /// In order to deallocate previously allocated memory pass 0
+    /// as \p indexCount. Don't forget to recreate with a non-zero
+    /// value when graphics memory should be allocated again.
+    ///
+    /// \param indexCount Number of indices worth of memory to allocate
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the index count
+    ///
+    /// \return Number of indices in the index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of 16-bit indices
+    ///
+    /// The buffer must have the sf::IndexBuffer::IndexType::UInt16
+    /// index type, otherwise the update fails.
+    ///
+    /// \p offset is specified as the number of indices to skip
+    /// from the beginning of the buffer.
+    ///
+    /// If \p offset is 0 and \p indexCount is greater than or
+    /// equal to the size of the currently created buffer, a new
+    /// buffer is created containing the index data.
+    ///
+    /// If \p offset is not 0 and \p offset + \p indexCount is greater
+    /// than the size of the currently created buffer, the update fails.
+    ///
+    /// No additional check is performed on the size of the index
+    /// array. Passing invalid arguments will lead to undefined
+    /// behavior.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint16_t* indices, std::size_t indexCount, unsigned int offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of 32-bit indices
+    ///
+    /// The buffer must have the sf::IndexBuffer::IndexType::UInt32
+    /// index type, otherwise the update fails.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return True if the update was successful
+    ///
+    /// \see update(const std::uint16_t*, std::size_t, unsigned int)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint32_t* indices, std::size_t indexCount, unsigned int offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(const IndexBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this index buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(IndexBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the index buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the index buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the type of the indices stored in the index buffer
+    ///
+    /// \return Index type
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexType getIndexType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this index buffer
+    ///
+    /// This function provides a hint about how this index buffer is
+    /// going to be used in terms of data update frequency.
+    ///
+    /// After changing the usage specifier, the index buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is sf::IndexBuffer::Usage::Static.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this index buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind an index buffer for rendering
+    ///
+    /// This function is not part of the graphics API, it mustn't be
+    /// used when drawing SFML entities. It must be used only if you
+    /// mix sf::IndexBuffer with OpenGL code.
+    ///
+    /// \param indexBuffer Pointer to the index buffer to bind, can be null to use no index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bind(const IndexBuffer* indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports index buffers
+    ///
+    /// Index buffers are available whenever vertex buffers are.
+    ///
+    /// \return True if index buffers are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of indices of any type
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    /// \param type       Type of the indices in \p indices
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool updateIndices(const void* indices, std::size_t indexCount, unsigned int offset, IndexType type);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};                     //!< Internal buffer identifier
+    std::size_t  m_size{};                       //!< Size in indices of the currently allocated buffer
+    IndexType    m_indexType{IndexType::UInt16}; //!< Type of the indices
+    Usage        m_usage{Usage::Static};         //!< How this index buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one index buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(IndexBuffer& left, IndexBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IndexBuffer
+/// \ingroup graphics
+///
+/// sf::IndexBuffer stores indices into a sf::VertexBuffer in
+/// graphics memory. Drawing a vertex buffer together with an
+/// index buffer lets primitives share vertices: a quad only
+/// needs 4 vertices and 6 indices instead of 6 vertices, and
+/// the vertices of a tile map or a mesh are stored only once.
+///
+/// The indices are either 16-bit or 32-bit, as chosen when
+/// constructing the buffer.
+///
+/// Example:
+/// \code
+/// // A grid of quads sharing their corners
+/// sf::VertexBuffer vertices(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+/// vertices.create((width + 1) * (height + 1));
+/// vertices.update(corners.data());
+///
+/// std::vector<std::uint16_t> indices;
+/// for (std::uint16_t y = 0; y < height; ++y)
+///     for (std::uint16_t x = 0; x < width; ++x)
+///     {
+///         const std::uint16_t topLeft = y * (width + 1) + x;
+///         const std::uint16_t bottomLeft = topLeft + width + 1;
+///         indices.insert(indices.end(), {topLeft, bottomLeft, topLeft + 1, topLeft + 1, bottomLeft, bottomLeft + 1});
+///     }
+///
+/// sf::IndexBuffer indexBuffer;
+/// indexBuffer.create(indices.size());
+/// indexBuffer.update(indices.data(), indices.size());
+/// ...
+/// window.draw(vertices, indexBuffer);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
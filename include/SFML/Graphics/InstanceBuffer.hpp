@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <array>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Per-instance transforms and colors for instanced drawing
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API InstanceBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty instance buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer(const InstanceBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~InstanceBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer& operator=(const InstanceBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an instance to the buffer
+    ///
+    /// Only the 2D part of \a transform is stored: translation,
+    /// rotation, scale and shear.
+    ///
+    /// \param transform Transform applied to the vertices of the instance
+    /// \param color     Color multiplied with the vertices of the instance
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const Transform& transform, const Color& color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change an instance of the buffer
+    ///
+    /// \param index     Index of the instance to change
+    /// \param transform Transform applied to the vertices of the instance
+    /// \param color     Color multiplied with the vertices of the instance
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstance(std::size_t index, const Transform& transform, const Color& color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the instances from the buffer
+    ///
+    /// The allocated memory is kept for the next instances.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of instances in the buffer
+    ///
+    /// \return Number of instances
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getInstanceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of an instance
+    ///
+    /// \param index Index of the instance
+    ///
+    /// \return Transform applied to the vertices of the instance
+    ///
+    ////////////////////////////////////////////////////////////
+    Transform getTransform(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color of an instance
+    ///
+    /// \param index Index of the instance
+    ///
+    /// \return Color multiplied with the vertices of the instance
+    ///
+    ////////////////////////////////////////////////////////////
+    Color getColor(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this instance buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(InstanceBuffer& right) noexcept;
+
+private:
+    friend class RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Instance attributes, as laid out in graphics memory
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Instance
+    {
+        std::array<float, 3> row0;  //!< First row of the 2D affine transform
+        std::array<float, 3> row1;  //!< Second row of the 2D affine transform
+        Color                color; //!< Color of the instance
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the instances to graphics memory if they changed
+    ///
+    /// \return OpenGL handle of the buffer holding the instances, 0 on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int upload() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Instance> m_instances;    //!< Instances in system memory
+    mutable unsigned int  m_buffer{};     //!< Internal buffer identifier
+    mutable std::size_t   m_bufferSize{}; //!< Size in instances of the currently allocated buffer
+    mutable bool          m_needUpload{}; //!< Do the instances differ from the ones in graphics memory?
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one instance buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(InstanceBuffer& left, InstanceBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::InstanceBuffer
+/// \ingroup graphics
+///
+/// sf::InstanceBuffer holds a transform and a color for each
+/// copy of a mesh drawn with sf::RenderTarget::drawInstanced.
+/// The whole set of copies is drawn in a single draw call,
+/// which is much faster than drawing thousands of identical
+/// entities (bullets, tiles, particles) one after the other.
+///
+/// The instances live in system memory and are uploaded to
+/// graphics memory when they are drawn after a change.
+/// Without driver support for instancing (OpenGL 3.3), or
+/// when the draw uses a custom shader, the copies are
+/// expanded on the CPU instead and the result is the same.
+///
+/// Example:
+/// \code
+/// sf::VertexBuffer bullet(sf::PrimitiveType::TriangleFan, sf::VertexBuffer::Usage::Static);
+/// ...
+/// sf::InstanceBuffer instances;
+/// for (const auto& b : bullets)
+///     instances.append(sf::Transform().translate(b.position).rotate(b.angle), b.color);
+///
+/// window.drawInstanced(bullet, instances);
+/// \endcode
+///
+/// \see sf::RenderTarget::drawInstanced, sf::VertexBuffer
+///
+////////////////////////////////////////////////////////////
@@ -42,6 +42,8 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -50,6 +52,8 @@
 namespace sf
 {
 class Drawable;
+class IndexBuffer;
+class InstanceBuffer;
 class Shader;
 class Texture;
 class Transform;
@@ -62,6 +66,20 @@ class VertexBuffer;
 class SFML_GRAPHICS_API RenderTarget
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters of the culling stage
+    ///
+    /// Only drawables that provide culling bounds are counted.
+    ///
+    /// \see setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CullingStatistics
+    {
+        std::size_t submitted{}; //!< Number of drawables found visible and drawn
+        std::size_t culled{};    //!< Number of drawables found out of view and skipped
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -344,6 +362,185 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and an array of 16-bit indices
+    ///
+    /// The primitives are assembled from the vertices referenced
+    /// by \p indices, in order, so that vertices shared by several
+    /// primitives only need to be stored once. All the indices
+    /// must be lower than \p vertexCount.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint16_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and an array of 32-bit indices
+    ///
+    /// 32-bit indices may not be supported with OpenGL ES.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \see draw(const Vertex*, std::size_t, const std::uint16_t*, std::size_t, PrimitiveType, const RenderStates&)
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint32_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and an index buffer
+    ///
+    /// The primitives are assembled from the vertices of
+    /// \p vertexBuffer referenced by the indices of \p indexBuffer,
+    /// using the primitive type of \p vertexBuffer.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and a range of an index buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param firstIndex   Index of the first index to render
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw many copies of primitives defined by an array of vertices
+    ///
+    /// The primitives are drawn once for each instance of
+    /// \p instances, transformed by the instance's transform
+    /// (before \p states.transform) and with their colors
+    /// modulated by the instance's color.
+    ///
+    /// All the copies are drawn in a single draw call when the
+    /// graphics driver supports instancing; otherwise they are
+    /// expanded on the CPU.
+    ///
+    /// A custom shader in \p states receives the instances through
+    /// these vertex attributes, which it may declare as needed:
+    /// \code
+    /// attribute vec3 sf_instanceRow0;  // First row of the instance's transform
+    /// attribute vec3 sf_instanceRow1;  // Second row of the instance's transform
+    /// attribute vec4 sf_instanceColor; // Color of the instance
+    /// \endcode
+    /// The position of a vertex in the instance is then
+    /// `vec2(dot(sf_instanceRow0, p), dot(sf_instanceRow1, p))`
+    /// with `p = vec3(gl_Vertex.xy, 1.0)`. When the instances are
+    /// expanded on the CPU, the attributes hold the identity
+    /// transform and a white color. This happens when instancing
+    /// is not supported, or when a custom shader uses none of the
+    /// attributes; for the vertex buffer overload, it means
+    /// reading the buffer back on every draw.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param instances   Instances to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstanced(const Vertex*         vertices,
+                       std::size_t           vertexCount,
+                       PrimitiveType         type,
+                       const InstanceBuffer& instances,
+                       const RenderStates&   states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw many copies of primitives defined by a vertex buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param instances    Instances to draw
+    /// \param states       Render states to use for drawing
+    ///
+    /// \see drawInstanced(const Vertex*, std::size_t, PrimitiveType, const InstanceBuffer&, const RenderStates&)
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstanced(const VertexBuffer&   vertexBuffer,
+                       const InstanceBuffer& instances,
+                       const RenderStates&   states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable culling of drawables that are out of view
+    ///
+    /// When culling is enabled, draw(const Drawable&, const RenderStates&)
+    /// first transforms the bounds returned by the drawable's
+    /// getCullingBounds function into the current view, and
+    /// skips the drawable entirely when they don't overlap the
+    /// visible area (taking the viewport and scissor rectangle
+    /// into account). Since the test uses axis-aligned bounding
+    /// boxes it is conservative: it may draw objects that are
+    /// just outside of the view, but never skips visible ones.
+    ///
+    /// sf::Sprite, sf::Shape and sf::Text provide culling
+    /// bounds, other drawables are always drawn.
+    ///
+    /// Culling is disabled by default.
+    ///
+    /// \param enabled True to enable culling, false to disable it
+    ///
+    /// \see isCullingEnabled, getCullingStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCullingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether culling of drawables is enabled
+    ///
+    /// \return True if culling is enabled, false otherwise
+    ///
+    /// \see setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isCullingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters of the culling stage
+    ///
+    /// The counters are reset every time the target is cleared
+    /// with a color, so they describe the current frame.
+    ///
+    /// \return Numbers of drawables drawn and culled since the last clear
+    ///
+    /// \see setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    const CullingStatistics& getCullingStatistics() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -523,6 +720,36 @@ private:
     ////////////////////////////////////////////////////////////
     void setupDraw(bool useVertexCache, const RenderStates& states);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Setup environment for drawing an array of vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void setupVertexArray(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and an array of indices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexSize   Size of an index in bytes
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexed(const Vertex*       vertices,
+                     std::size_t         vertexCount,
+                     const void*         indices,
+                     std::size_t         indexSize,
+                     std::size_t         indexCount,
+                     PrimitiveType       type,
+                     const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the primitives
     ///
@@ -533,6 +760,72 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the primitives referenced by indices
+    ///
+    /// \param type       Type of primitives to draw
+    /// \param indices    Pointer to the indices, or offset in the bound index buffer
+    /// \param indexSize  Size of an index in bytes
+    /// \param indexCount Number of indices to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, const void* indices, std::size_t indexSize, std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the primitives once per instance
+    ///
+    /// \param type           Type of primitives to draw
+    /// \param firstVertex    Index of the first vertex to use when drawing
+    /// \param vertexCount    Number of vertices to use when drawing
+    /// \param attributes     Locations of the instance attributes, -1 for the ones the shader doesn't use
+    /// \param instanceBuffer OpenGL buffer containing the instances
+    /// \param instanceCount  Number of instances to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstancedPrimitives(PrimitiveType             type,
+                                 std::size_t               firstVertex,
+                                 std::size_t               vertexCount,
+                                 const std::array<int, 3>& attributes,
+                                 unsigned int              instanceBuffer,
+                                 std::size_t               instanceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw instances by transforming copies of the vertices on the CPU
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param instances   Instances to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawExpandedInstances(const Vertex*         vertices,
+                               std::size_t           vertexCount,
+                               PrimitiveType         type,
+                               const InstanceBuffer& instances,
+                               const RenderStates&   states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader transforming instances on the GPU
+    ///
+    /// The shader is compiled on first use.
+    ///
+    /// \return Pointer to the shader, or a null pointer if instancing is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    Shader* getInstancingShader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the locations of the instance attributes of a shader
+    ///
+    /// \param shader Custom shader of the draw, or a null pointer to use the instancing shader
+    ///
+    /// \return Locations of sf_instanceRow0, sf_instanceRow1 and sf_instanceColor,
+    ///         -1 for the ones that the shader doesn't use or if instancing is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    std::array<int, 3> getInstanceAttributes(const Shader* shader);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -564,10 +857,16 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View                    m_defaultView;                     //!< Default view
+    View                    m_view;                            //!< Current view
+    StatesCache             m_cache{};                         //!< Render states cache
+    std::uint64_t           m_id{};                            //!< Unique number that identifies the RenderTarget
+    std::shared_ptr<Shader> m_instancingShader;                //!< Shader transforming instances on the GPU
+    std::array<int, 3>      m_instanceAttributes{};            //!< Locations of the per-instance shader attributes
+    bool                    m_instancingShaderLoadAttempted{}; //!< Was compiling the instancing shader attempted?
+    std::vector<Vertex>     m_instanceVertices;                //!< Instances expanded on the CPU
+    bool                    m_cullingEnabled{};                //!< Are out of view drawables skipped?
+    CullingStatistics       m_cullingStatistics;               //!< Counters of the culling stage for the current frame
 };
 
 } // namespace sf
@@ -0,0 +1,260 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/ContextSettings.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class RenderTexture;
+
+////////////////////////////////////////////////////////////
+/// \brief Recycle render textures instead of creating
+///        new ones every time
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderTexturePool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters of the pool
+    ///
+    /// \see getStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t created{}; //!< Number of render textures created by the pool
+        std::size_t reused{};  //!< Number of requests served with a recycled render texture
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pool
+    ///
+    /// Requested sizes are rounded up to a multiple of
+    /// \a bucketSize, so that requests of slightly different
+    /// sizes (while a window is being resized for example) can
+    /// share the same render textures. With the default value
+    /// of 1, render textures are only shared between requests
+    /// of the exact same size.
+    ///
+    /// \param bucketSize Granularity of the sizes of the render textures, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit RenderTexturePool(unsigned int bucketSize = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// All the render textures of the pool are destroyed,
+    /// including the ones that are still in use.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(RenderTexturePool&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(RenderTexturePool&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a render texture from the pool
+    ///
+    /// An unused render texture of the same size bucket and
+    /// settings is returned if there is one, otherwise a new
+    /// one is created. The render texture remains owned by the
+    /// pool and must be given back with recycle once it is no
+    /// longer needed.
+    ///
+    /// The render texture may be larger than \a size if the
+    /// bucket size is greater than 1. Its view is then set so
+    /// that the default coordinates cover \a size pixels in its
+    /// top-left corner, which is the area to display (with
+    /// `sf::IntRect({0, 0}, sf::Vector2i(size))` as the texture
+    /// rectangle of a sprite for example).
+    ///
+    /// Smoothing and repeating are disabled on the returned
+    /// render texture, and its contents are undefined: call
+    /// clear before drawing to it.
+    ///
+    /// \param size     Width and height of the render texture
+    /// \param settings Additional settings for the underlying OpenGL texture and context
+    ///
+    /// \return Pointer to the render texture, or a null pointer if it could not be created
+    ///
+    /// \see recycle
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexture* acquire(const Vector2u& size, const ContextSettings& settings = ContextSettings());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a render texture back to the pool
+    ///
+    /// The render texture, with its texture and framebuffer,
+    /// is kept alive so that a later call to acquire can reuse
+    /// it. It must not be used after this call.
+    ///
+    /// \param renderTexture Render texture previously returned by acquire
+    ///
+    /// \see acquire, releaseUnused
+    ///
+    ////////////////////////////////////////////////////////////
+    void recycle(RenderTexture& renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the render textures that are not in use
+    ///
+    /// Call this function to free the graphics memory held by
+    /// the pool, for example after switching to a scene that
+    /// doesn't use the same effects.
+    ///
+    /// \see recycle
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseUnused();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the granularity of the sizes of the render textures
+    ///
+    /// \return Bucket size, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getBucketSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures currently acquired
+    ///
+    /// \return Number of render textures in use
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getInUseCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures waiting to be reused
+    ///
+    /// \return Number of unused render textures kept by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getAvailableCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters of the pool
+    ///
+    /// The number of reused render textures is the number of
+    /// render texture creations that the pool avoided.
+    ///
+    /// \return Counters accumulated since the construction of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Statistics& getStatistics() const;
+
+private:
+    struct Entry;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int       m_bucketSize; //!< Granularity of the sizes of the render textures
+    std::vector<Entry> m_entries;    //!< Render textures owned by the pool
+    Statistics         m_statistics; //!< Counters of the pool
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTexturePool
+/// \ingroup graphics
+///
+/// Creating a sf::RenderTexture allocates a texture, a
+/// framebuffer and possibly depth, stencil and multisample
+/// buffers, which can take several milliseconds. Effects that
+/// need temporary render targets (post-processing chains,
+/// blurs, off-screen compositing) should not pay this cost
+/// every time they run.
+///
+/// sf::RenderTexturePool keeps the render textures that are
+/// given back to it, and hands them out again to subsequent
+/// requests with the same size bucket and context settings.
+///
+/// Example:
+/// \code
+/// sf::RenderTexturePool pool;
+///
+/// while (window.isOpen())
+/// {
+///     // Render the scene to an intermediate texture
+///     sf::RenderTexture* scene = pool.acquire(window.getSize());
+///     if (!scene)
+///         return -1;
+///
+///     scene->clear();
+///     scene->draw(...);
+///     scene->display();
+///
+///     // Apply the effect while drawing it to the window
+///     window.clear();
+///     window.draw(sf::Sprite(scene->getTexture()), &effect);
+///     window.display();
+///
+///     // The next frame will reuse the same render texture
+///     pool.recycle(*scene);
+/// }
+/// \endcode
+///
+/// \see sf::RenderTexture
+///
+////////////////////////////////////////////////////////////
@@ -37,6 +37,8 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <cstddef>
 
@@ -45,6 +47,7 @@ namespace sf
 {
 class InputStream;
 class Texture;
+class UniformBuffer;
 
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex, geometry and fragment)
@@ -84,6 +87,39 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Precomputed reference to a uniform of a shader
+    ///
+    /// A handle is obtained once with getUniformHandle() and can
+    /// then be passed to setUniform() instead of the uniform's name,
+    /// which avoids looking the name up every time the value changes.
+    /// A handle is only meaningful for the shader that returned it.
+    ///
+    /// \see getUniformHandle
+    ///
+    ////////////////////////////////////////////////////////////
+    class UniformHandle
+    {
+    private:
+        friend class Shader;
+
+        UniformHandle() = default;
+
+        std::size_t m_slot{}; //!< Index of the uniform in the shader's table of uniforms
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters of the program binary cache
+    ///
+    /// \see setProgramCacheDirectory
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ProgramCacheStatistics
+    {
+        std::size_t hits{};   //!< Number of programs loaded from the cache
+        std::size_t misses{}; //!< Number of programs not found in the cache while it was enabled
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -578,6 +614,187 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a uniform buffer to a uniform block of the shader
+    ///
+    /// \p name is the name of a uniform block declared in GLSL,
+    /// for example `Frame` for this block:
+    /// \code
+    /// layout(std140) uniform Frame
+    /// {
+    ///     mat4 camera;
+    ///     float time;
+    /// };
+    /// \endcode
+    ///
+    /// The shader reads the block from \p buffer every time it
+    /// is used, so the values need to be updated only once in
+    /// the buffer to be seen by all the shaders it is bound to.
+    ///
+    /// It is important to note that \p buffer must remain alive as long
+    /// as the shader uses it, no copy is made internally.
+    ///
+    /// This function fails if uniform buffers are not supported,
+    /// see sf::UniformBuffer::isAvailable.
+    ///
+    /// \param name   Name of the uniform block in GLSL
+    /// \param buffer Uniform buffer holding the values of the block
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlock(const std::string& name, const UniformBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow binding from a temporary uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlock(const std::string& name, UniformBuffer&& buffer) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a handle to a uniform, to set its value without looking up its name
+    ///
+    /// Values set through a handle are staged in the shader and
+    /// uploaded all at once the next time the shader is bound,
+    /// which happens when something is drawn with it.
+    ///
+    /// \code
+    /// const auto time = shader.getUniformHandle("u_time").value();
+    /// ...
+    /// shader.setUniform(time, clock.getElapsedTime().asSeconds());
+    /// \endcode
+    ///
+    /// \param name Name of the uniform variable in GLSL
+    ///
+    /// \return Handle to the uniform, `std::nullopt` if the shader has no such uniform
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<UniformHandle> getUniformHandle(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p float uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param x      Value of the float scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec2 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the vec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec2& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec3 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the vec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec4 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the vec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p int uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param x      Value of the int scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec2 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the ivec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec2& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec3 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the ivec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec4 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the ivec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bool uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param x      Value of the bool scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec2 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the bvec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec2& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec3 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the bvec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec4 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param vector Value of the bvec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat3 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param matrix Value of the mat3 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat4 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform, obtained from getUniformHandle()
+    /// \param matrix Value of the mat4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat4& matrix);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -644,6 +861,52 @@ public:
     ////////////////////////////////////////////////////////////
     static bool isGeometryAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable the program binary cache
+    ///
+    /// When a directory is set, the programs linked by the load
+    /// functions are saved in it in the driver's binary format,
+    /// and loading the same sources again later (typically the
+    /// next time the application starts) reuses the binaries
+    /// instead of compiling the sources.
+    ///
+    /// The binaries are specific to the graphics driver: they
+    /// are keyed by the sources and by the vendor, renderer and
+    /// version of OpenGL. A binary that the driver rejects (after
+    /// a driver update for example) is silently replaced by a
+    /// regular compilation.
+    ///
+    /// The cache is disabled by default, and has no effect if the
+    /// driver doesn't support program binaries (OpenGL 4.1 or
+    /// ARB_get_program_binary).
+    ///
+    /// \param directory Directory to store the binaries in, created if needed, or an empty path to disable the cache
+    ///
+    /// \see getProgramCacheDirectory, getProgramCacheStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setProgramCacheDirectory(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory of the program binary cache
+    ///
+    /// \return Directory of the cache, empty if the cache is disabled
+    ///
+    /// \see setProgramCacheDirectory
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::filesystem::path getProgramCacheDirectory();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the hit and miss counters of the program binary cache
+    ///
+    /// \return Counters accumulated since the start of the application
+    ///
+    /// \see setProgramCacheDirectory
+    ///
+    ////////////////////////////////////////////////////////////
+    static ProgramCacheStatistics getProgramCacheStatistics();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Construct from shader program
@@ -677,6 +940,15 @@ private:
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind all the uniform buffers used by the shader
+    ///
+    /// Each uniform block of the shader has its own binding point,
+    /// this function binds the buffer of each block to it.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlocks() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
@@ -687,6 +959,44 @@ private:
     ////////////////////////////////////////////////////////////
     int getUniformLocation(const std::string& name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of a uniform in the table of uniforms
+    ///
+    /// The uniform is added to the table on first use.
+    ///
+    /// \param name Name of the uniform variable to search
+    ///
+    /// \return Index of the uniform in m_uniformSlots
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getUniformSlot(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Information and staged value of a uniform
+    ///
+    /// Implementation is private in the .cpp file.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct UniformSlot;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the value of a uniform as waiting for upload
+    ///
+    /// \param handle Handle to the uniform
+    ///
+    /// \return Slot of the uniform, to store the value in
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformSlot& stageUniform(UniformHandle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the staged uniform values to the program
+    ///
+    /// The program must be in use.
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadStagedUniforms() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief RAII object to save and restore the program
     ///        binding while uniforms are being set
@@ -700,15 +1010,19 @@ private:
     // Types
     ////////////////////////////////////////////////////////////
     using TextureTable = std::unordered_map<int, const Texture*>;
-    using UniformTable = std::unordered_map<std::string, int>;
+    using UniformTable = std::unordered_map<std::string, std::size_t>;
+    using UniformBlockTable = std::vector<std::pair<unsigned int, const UniformBuffer*>>;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
-    int          m_currentTexture{-1}; //!< Location of the current texture in the shader
-    TextureTable m_textures;           //!< Texture variables in the shader, mapped to their location
-    UniformTable m_uniforms;           //!< Parameters location cache
+    unsigned int                     m_shaderProgram{};    //!< OpenGL identifier for the program
+    int                              m_currentTexture{-1}; //!< Location of the current texture in the shader
+    TextureTable                     m_textures;           //!< Texture variables in the shader, by location
+    UniformTable                     m_uniforms;           //!< Parameters cache, mapped to their slot
+    mutable std::vector<UniformSlot> m_uniformSlots;       //!< Locations and staged values of the uniforms
+    mutable std::vector<std::size_t> m_stagedUniforms;     //!< Slots of the uniforms waiting for upload
+    UniformBlockTable                m_uniformBlocks;      //!< Uniform blocks, by binding point, and their buffers
 };
 
 } // namespace sf
@@ -775,6 +1089,16 @@ private:
 /// given \p sampler2D uniform to the current texture of the
 /// object being drawn (which cannot be known in advance).
 ///
+/// Uniforms that change every frame are cheaper to set through
+/// a handle, which is looked up once with getUniformHandle().
+/// Values set through a handle are staged and uploaded together
+/// the next time the shader is used for drawing:
+/// \code
+/// const auto offset = shader.getUniformHandle("offset").value();
+/// ...
+/// shader.setUniform(offset, 2.f);
+/// \endcode
+///
 /// To apply a shader to a drawable, you must pass it as an
 /// additional parameter to the \ref RenderWindow::draw function:
 /// \code
@@ -791,6 +1115,11 @@ private:
 /// In the code above we pass a pointer to the shader, because it may
 /// be null (which means "no shader").
 ///
+/// Compiling many shaders can noticeably slow down the start of
+/// an application. Enabling the program binary cache with
+/// setProgramCacheDirectory() saves the compiled programs to disk,
+/// so that the next runs load them instead of compiling them.
+///
 /// Shaders can be used on any drawable, but some combinations are
 /// not interesting. For example, using a vertex shader on a sf::Sprite
 /// is limited because there are only 4 vertices, the sprite would
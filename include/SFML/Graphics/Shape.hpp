@@ -270,9 +270,27 @@ protected:
     /// the shape's points change (i.e. the result of either
     /// getPointCount or getPoint is different).
     ///
+    /// The geometry is not recomputed immediately: it is rebuilt
+    /// the next time the shape is drawn or its bounds are
+    /// requested, so calling this function several times in a
+    /// row is cheap.
+    ///
     ////////////////////////////////////////////////////////////
     void update();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the internal geometry of the shape after it was scaled
+    ///
+    /// This function can be called by the derived class instead of
+    /// update when all the shape's points were multiplied by the
+    /// same positive factor, i.e. when the shape was scaled around
+    /// its local origin. The outline is then moved along with the
+    /// points instead of being computed again, and the texture
+    /// coordinates are kept.
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateScaled();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Draw the shape to a render target
@@ -283,42 +301,69 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the shape
+    ///
+    /// \return Global bounding rectangle of the shape
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<FloatRect> getCullingBounds() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the parts of the geometry that are out of date
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureGeometryUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the fill vertices' position and the inside bounds
+    ///
+    ////////////////////////////////////////////////////////////
+    void updatePoints() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateFillColors();
+    void updateFillColors() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' texture coordinates
     ///
     ////////////////////////////////////////////////////////////
-    void updateTexCoords();
+    void updateTexCoords() const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Update the outline vertices' position
+    /// \brief Update the outline vertices' position and the bounds
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutline();
+    void updateOutline() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutlineColors();
+    void updateOutlineColors() const;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const Texture* m_texture{};                  //!< Texture of the shape
-    IntRect        m_textureRect;                //!< Rectangle defining the area of the source texture to display
-    Color          m_fillColor{Color::White};    //!< Fill color
-    Color          m_outlineColor{Color::White}; //!< Outline color
-    float          m_outlineThickness{};         //!< Thickness of the shape's outline
-    VertexArray    m_vertices{PrimitiveType::TriangleFan};          //!< Vertex array containing the fill geometry
-    VertexArray    m_outlineVertices{PrimitiveType::TriangleStrip}; //!< Vertex array containing the outline geometry
-    FloatRect      m_insideBounds;                                  //!< Bounding rectangle of the inside (fill)
-    FloatRect      m_bounds; //!< Bounding rectangle of the whole shape (outline + fill)
+    const Texture*      m_texture{};                  //!< Texture of the shape
+    IntRect             m_textureRect;                //!< Rectangle defining the area of the source texture to display
+    Color               m_fillColor{Color::White};    //!< Fill color
+    Color               m_outlineColor{Color::White}; //!< Outline color
+    float               m_outlineThickness{};         //!< Thickness of the shape's outline
+    mutable VertexArray m_vertices{PrimitiveType::TriangleFan};          //!< Vertex array of the fill geometry
+    mutable VertexArray m_outlineVertices{PrimitiveType::TriangleStrip}; //!< Vertex array of the outline geometry
+    mutable FloatRect   m_insideBounds;              //!< Bounding rectangle of the inside (fill)
+    mutable FloatRect   m_bounds;                    //!< Bounding rectangle of the whole shape (outline + fill)
+    mutable bool        m_pointsNeedUpdate{};        //!< Do the fill positions need to be recomputed?
+    mutable bool        m_fillColorsNeedUpdate{};    //!< Do the fill colors need to be recomputed?
+    mutable bool        m_texCoordsNeedUpdate{};     //!< Do the texture coordinates need to be recomputed?
+    mutable bool        m_outlineNeedUpdate{};       //!< Do the outline positions need to be recomputed?
+    mutable bool        m_outlineColorsNeedUpdate{}; //!< Do the outline colors need to be recomputed?
+    mutable bool        m_pointsScaled{};            //!< Were the fill positions only scaled since the last update?
+    mutable bool        m_outlineScaled{};           //!< Can the outline positions be moved along with the fill ones?
 };
 
 } // namespace sf
@@ -210,6 +210,14 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the sprite
+    ///
+    /// \return Global bounding rectangle of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<FloatRect> getCullingBounds() const override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the vertices' positions
     ///
@@ -0,0 +1,244 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class RenderTarget;
+class Sprite;
+
+////////////////////////////////////////////////////////////
+/// \brief Collection of textured quads drawn with as few
+///        draw calls as possible
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpriteBatch : public Drawable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Policy deciding which quads may share a draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class FlushPolicy
+    {
+        Ordered, //!< Only consecutive quads with identical states are merged, the drawing order is preserved
+        ByState  //!< All the quads with identical states are merged, regardless of what was appended in between
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty batch using the sf::SpriteBatch::FlushPolicy::Ordered policy.
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty batch with a given flush policy
+    ///
+    /// \param policy Policy deciding which quads may share a draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(FlushPolicy policy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the flush policy
+    ///
+    /// The policy only affects quads appended after the call,
+    /// the existing batches are left untouched.
+    ///
+    /// \param policy New flush policy
+    ///
+    /// \see getFlushPolicy
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFlushPolicy(FlushPolicy policy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the flush policy
+    ///
+    /// \return Current flush policy
+    ///
+    /// \see setFlushPolicy
+    ///
+    ////////////////////////////////////////////////////////////
+    FlushPolicy getFlushPolicy() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite to the batch
+    ///
+    /// The sprite is transformed on the CPU, using both its own
+    /// transform and the transform of \a states, so it can be
+    /// modified or destroyed right after this call. Its texture
+    /// however must stay alive as long as the batch is drawn.
+    ///
+    /// \param sprite Sprite to add
+    /// \param states Render states to use for drawing the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const Sprite& sprite, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a quad to the batch
+    ///
+    /// The 4 vertices are expected in the same order as for
+    /// the sf::PrimitiveType::TriangleStrip primitive type:
+    /// top-left, bottom-left, top-right, bottom-right.
+    /// They are transformed on the CPU by the transform of \a states.
+    ///
+    /// \param quad   Pointer to the 4 vertices of the quad
+    /// \param states Render states to use for drawing the quad
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const Vertex* quad, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the quads from the batch
+    ///
+    /// This function doesn't deallocate the corresponding memory,
+    /// so that filling the batch again every frame doesn't
+    /// involve reallocating all the memory.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of quads in the batch
+    ///
+    /// \return Number of quads appended since the last call to clear()
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getQuadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of draw calls needed to draw the batch
+    ///
+    /// Each run of quads sharing the same texture, blend mode,
+    /// stencil mode and shader costs a single draw call.
+    ///
+    /// \return Number of draw calls issued when drawing the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getBatchCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the batch to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find or create the batch matching some render states
+    ///
+    /// \param states Render states of the quad to add
+    ///
+    /// \return Vertices of the batch the quad must be added to
+    ///
+    ////////////////////////////////////////////////////////////
+    std::vector<Vertex>& findBatch(const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run of quads sharing the same render states
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        RenderStates        states;   //!< Render states of the batch (with an identity transform)
+        std::vector<Vertex> vertices; //!< Pre-transformed vertices, as triangles
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Batch> m_batches;                         //!< Batches, only the first m_batchCount ones are in use
+    std::size_t        m_batchCount{};                    //!< Number of batches in use
+    std::size_t        m_quadCount{};                     //!< Number of quads in the batch
+    FlushPolicy        m_flushPolicy{FlushPolicy::Ordered}; //!< Policy deciding which quads may share a draw call
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// Drawing a sf::Sprite costs a full draw call, even though
+/// it is only made of 4 vertices. When thousands of sprites
+/// are drawn every frame, the time spent in the draw calls
+/// quickly becomes the bottleneck.
+///
+/// sf::SpriteBatch collects sprites (or raw quads), transforms
+/// their vertices on the CPU and groups them by render states.
+/// When the batch is drawn, each group of quads sharing the
+/// same texture, blend mode, stencil mode and shader is
+/// rendered with a single draw call.
+///
+/// With the default sf::SpriteBatch::FlushPolicy::Ordered
+/// policy, quads are drawn exactly in the order they were
+/// appended, so only consecutive quads with identical states
+/// are merged. If the quads don't overlap, or if their relative
+/// order doesn't matter, the sf::SpriteBatch::FlushPolicy::ByState
+/// policy merges all the quads sharing the same states, which
+/// minimizes the number of draw calls.
+///
+/// Example:
+/// \code
+/// sf::SpriteBatch batch;
+///
+/// while (window.isOpen())
+/// {
+///     batch.clear();
+///     for (const auto& sprite : sprites)
+///         batch.append(sprite);
+///
+///     window.clear();
+///     window.draw(batch);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Sprite, sf::VertexArray
+///
+////////////////////////////////////////////////////////////
@@ -69,6 +69,16 @@ public:
         StrikeThrough = 1 << 3  //!< Strike through characters
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enumeration of the ways glyphs can be rendered
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class RenderMode
+    {
+        Bitmap,       //!< Glyphs are rasterized at the character size of the text
+        DistanceField //!< Glyphs are drawn at any size from the font's distance field atlas
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the text from a string, font and size
     ///
@@ -243,6 +253,39 @@ public:
     ////////////////////////////////////////////////////////////
     void setOutlineThickness(float thickness);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the way the glyphs of the text are rendered
+    ///
+    /// In RenderMode::Bitmap mode, the glyphs are rasterized
+    /// at the character size of the text, and the outline is
+    /// rasterized separately. This gives the best quality, but
+    /// each character size and outline thickness takes its own
+    /// space in the font's atlases.
+    ///
+    /// In RenderMode::DistanceField mode, the glyphs are drawn
+    /// from the single distance field atlas of the font (see
+    /// sf::Font::getDistanceFieldGlyph) with a shader, which
+    /// scales them to the character size of the text and draws
+    /// the outline. This is well suited to text whose size
+    /// changes a lot, e.g. when it is animated. The outline
+    /// thickness is limited to the range of the distance field.
+    /// Small characters may look slightly blurrier than in
+    /// bitmap mode.
+    ///
+    /// If shaders are not available, the text falls back to
+    /// bitmap mode. If the text is drawn with a custom shader,
+    /// that shader is given the distance field atlas and is
+    /// responsible for turning it into glyphs.
+    ///
+    /// By default, the render mode is RenderMode::Bitmap.
+    ///
+    /// \param mode New render mode
+    ///
+    /// \see getRenderMode
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRenderMode(RenderMode mode);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the text's string
     ///
@@ -345,6 +388,16 @@ public:
     ////////////////////////////////////////////////////////////
     float getOutlineThickness() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the way the glyphs of the text are rendered
+    ///
+    /// \return Render mode of the text
+    ///
+    /// \see setRenderMode
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderMode getRenderMode() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the position of the \a index-th character
     ///
@@ -391,6 +444,24 @@ public:
     FloatRect getGlobalBounds() const;
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief State of the layout after the last laid out character
+    ///
+    /// This allows laying out only the new characters when
+    /// some are appended to the string.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Layout
+    {
+        std::size_t   length{};             //!< Number of characters of the string that are laid out
+        Vector2f      position;             //!< Position of the next character
+        Vector2f      min;                  //!< Minimum coordinates of the laid out characters
+        Vector2f      max;                  //!< Maximum coordinates of the laid out characters
+        std::uint32_t prevChar{};           //!< Last laid out character
+        std::size_t   vertexCount{};        //!< Number of fill vertices, without the lines closing the text
+        std::size_t   outlineVertexCount{}; //!< Number of outline vertices, without the lines closing the text
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the text to a render target
     ///
@@ -400,15 +471,33 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the text
+    ///
+    /// \return Global bounding rectangle of the text
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<FloatRect> getCullingBounds() const override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Make sure the text's geometry is updated
     ///
     /// All the attributes related to rendering are cached, such
-    /// that the geometry is only updated when necessary.
+    /// that the geometry is only updated when necessary. When
+    /// characters are only appended to the string, only the new
+    /// characters are laid out.
     ///
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the glyphs are drawn from distance fields
+    ///
+    /// \return True if the text is in distance field mode and shaders are available
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isDistanceFieldRendered() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -421,11 +510,14 @@ private:
     Color                 m_fillColor{Color::White};                   //!< Text fill color
     Color                 m_outlineColor{Color::Black};                //!< Text outline color
     float                 m_outlineThickness{0.f};                     //!< Thickness of the text's outline
+    RenderMode            m_renderMode{RenderMode::Bitmap};            //!< Way the glyphs are rendered
     mutable VertexArray   m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
     mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
     mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
     mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
     mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
+    mutable Layout        m_layout;               //!< State of the layout, to append characters without a full update
+    mutable std::size_t   m_retryEvictionCount{}; //!< Glyphs evicted by the layout pass being retried, if any
 };
 
 } // namespace sf
@@ -563,8 +563,43 @@ public:
 
 private:
     friend class Text;
+    friend class Font;
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class TextureStreamer;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the texture with a single alpha channel
+    ///
+    /// Alpha-only textures use a quarter of the memory of regular
+    /// textures. They are rendered as white pixels with varying
+    /// alpha, and seen as such by shaders when texture swizzling
+    /// is supported (OpenGL 3.3 or ARB_texture_swizzle); otherwise
+    /// shaders read black pixels with varying alpha.
+    /// The public update functions still take RGBA pixels, use
+    /// updateAlpha to upload alpha values directly.
+    /// With OpenGL ES, a regular RGBA texture is created instead.
+    /// This function is mainly for internal use by sf::Font.
+    ///
+    /// \param size Width and height of the texture
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool createAlpha(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of an alpha-only texture from an array of alpha values
+    ///
+    /// The \a alpha array is assumed to have one byte per pixel,
+    /// and the texture must have been created with createAlpha.
+    ///
+    /// \param alpha Array of alpha values to copy to the texture
+    /// \param size  Width and height of the pixel region contained in \a alpha
+    /// \param dest  Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateAlpha(const std::uint8_t* alpha, const Vector2u& size, const Vector2u& dest);
 
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
@@ -590,6 +625,17 @@ private:
     ////////////////////////////////////////////////////////////
     void invalidateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the state of the texture after its pixels were modified
+    ///
+    /// This invalidates the mipmap, resets the orientation of the
+    /// pixels and gives the texture a new cache identifier so that
+    /// render targets bind it again.
+    /// This function is mainly for internal use by TextureStreamer.
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateContents();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -602,6 +648,7 @@ private:
     mutable bool  m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
     bool          m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
     bool          m_hasMipmap{};     //!< Has the mipmap been generated?
+    bool          m_alphaOnly{};     //!< Does the texture only have an alpha channel?
     std::uint64_t m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
 };
 
@@ -652,6 +699,13 @@ SFML_GRAPHICS_API void swap(Texture& left, Texture& right) noexcept;
 /// store the collision information separately, for example in an array
 /// of booleans.
 ///
+/// Updating a texture doesn't flush the OpenGL pipeline. Other
+/// contexts see the new pixels once the updating context is
+/// deactivated, another context is activated in its thread, or
+/// its window is displayed. A thread that keeps a context active
+/// while it updates textures for another thread has to deactivate
+/// it (or call glFlush) to publish the updates.
+///
 /// Like sf::Image, sf::Texture can handle a unique internal
 /// representation of pixels, which is RGBA 32 bits. This means
 /// that a pixel must be composed of 8 bits red, green, blue and
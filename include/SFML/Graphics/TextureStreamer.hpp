@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Upload pixels to textures and read them back
+///        without stalling the rendering thread
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureStreamer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the streamer
+    ///
+    /// The upload buffers are used in turn, a higher count lets
+    /// more uploads be in flight before the streamer has to
+    /// allocate new storage for a buffer still in use.
+    ///
+    /// \param bufferCount Number of pixel buffers used for uploads
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureStreamer(std::size_t bufferCount = 3);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Pending readbacks are discarded.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureStreamer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer(const TextureStreamer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue the update of a part of a texture from an array of pixels
+    ///
+    /// The pixels are copied to a pixel buffer object and the
+    /// function returns without waiting for the texture to be
+    /// updated. The \a pixels array can be reused right away.
+    /// The result is the same as calling Texture::update with
+    /// the same arguments.
+    ///
+    /// If streaming is not available, this function calls
+    /// Texture::update directly.
+    ///
+    /// \param texture Texture to update
+    /// \param pixels  Array of pixels to copy to the texture
+    /// \param size    Width and height of the pixel region contained in \a pixels
+    /// \param dest    Coordinates of the destination position
+    ///
+    /// \see requestReadback
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Texture& texture, const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue the update of a part of a texture from an image
+    ///
+    /// \param texture Texture to update
+    /// \param image   Image to copy to the texture
+    /// \param dest    Coordinates of the destination position
+    ///
+    /// \see requestReadback
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Texture& texture, const Image& image, const Vector2u& dest = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the contents of a texture to an image
+    ///
+    /// The copy is made into a pixel buffer object and the
+    /// function returns without waiting for it. The image holds
+    /// the contents of the texture at the time of the call, it
+    /// can be retrieved with pollReadback or waitReadback.
+    /// Readbacks complete in the order they were requested.
+    ///
+    /// If streaming is not available, the texture is copied
+    /// right away with Texture::copyToImage.
+    ///
+    /// \param texture Texture to copy
+    ///
+    /// \see pollReadback, waitReadback
+    ///
+    ////////////////////////////////////////////////////////////
+    void requestReadback(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the oldest readback if it has completed
+    ///
+    /// This function never waits for the GPU.
+    ///
+    /// \return Image of the oldest pending readback, or std::nullopt if it is not ready or none is pending
+    ///
+    /// \see requestReadback, waitReadback
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> pollReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the oldest readback, waiting for it if needed
+    ///
+    /// \return Image of the oldest pending readback, or std::nullopt if none is pending
+    ///
+    /// \see requestReadback, pollReadback
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> waitReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of readbacks not retrieved yet
+    ///
+    /// \return Number of pending readbacks
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingReadbackCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports streaming
+    ///
+    /// Streaming requires pixel buffer objects (OpenGL 2.1),
+    /// readbacks only avoid waiting for the GPU if fences are
+    /// supported as well (OpenGL 3.2 or ARB_sync).
+    /// When streaming is not available, the streamer falls back
+    /// to the synchronous functions of sf::Texture.
+    ///
+    /// \return True if streaming is supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    const std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureStreamer
+/// \ingroup graphics
+///
+/// Texture::update hands the pixels to the driver and waits
+/// for it to copy them, and Texture::copyToImage waits for
+/// all the pending rendering to complete before reading the
+/// texture back. For textures that change every frame
+/// (video playback, procedurally generated textures) or
+/// frequent readbacks (screenshots, GPU computations), these
+/// stalls add up.
+///
+/// sf::TextureStreamer transfers the pixels through a ring
+/// of pixel buffer objects instead: uploads are queued and
+/// performed by the GPU asynchronously, and readbacks are
+/// retrieved later, once the GPU signals that they are
+/// complete.
+///
+/// Example:
+/// \code
+/// sf::Texture texture;
+/// if (!texture.create({640, 480}))
+///     return -1;
+///
+/// sf::TextureStreamer streamer;
+///
+/// while (window.isOpen())
+/// {
+///     // Upload the next video frame without stalling
+///     streamer.update(texture, video.getNextFrame(), {640, 480}, {0, 0});
+///
+///     window.clear();
+///     window.draw(sf::Sprite(texture));
+///     window.display();
+///
+///     // Take a screenshot of the texture every second,
+///     // and save it once the GPU is done with it
+///     if (clock.getElapsedTime() > sf::seconds(1))
+///     {
+///         streamer.requestReadback(texture);
+///         clock.restart();
+///     }
+///
+///     if (const auto screenshot = streamer.pollReadback())
+///         (void)screenshot->saveToFile("screenshot.png");
+/// }
+/// \endcode
+///
+/// \see sf::Texture, sf::Image
+///
+////////////////////////////////////////////////////////////
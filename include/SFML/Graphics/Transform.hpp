@@ -35,10 +35,13 @@
 
 #include <array>
 
+#include <cstddef>
+
 
 namespace sf
 {
 class Angle;
+struct Vertex;
 
 ////////////////////////////////////////////////////////////
 /// \brief Define a 3x3 transform matrix
@@ -131,6 +134,41 @@ public:
     ////////////////////////////////////////////////////////////
     constexpr FloatRect transformRect(const FloatRect& rectangle) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// This is equivalent to calling transformPoint on each point,
+    /// but processes several points at once using SIMD instructions
+    /// where they are available, which makes it much faster for
+    /// large batches of points.
+    ///
+    /// \a points and \a output may point to the same array, in
+    /// which case the points are transformed in place. Other
+    /// kinds of overlap are not allowed.
+    ///
+    /// \param points Pointer to the points to transform
+    /// \param output Pointer to the array to fill with the transformed points
+    /// \param count  Number of points to transform
+    ///
+    /// \see transformPoint, transformVertices
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformPoints(const Vector2f* points, Vector2f* output, std::size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform the positions of an array of vertices in place
+    ///
+    /// Only the positions of the vertices are modified, their
+    /// colors and texture coordinates are left untouched.
+    ///
+    /// \param vertices Pointer to the vertices to transform
+    /// \param count    Number of vertices to transform
+    ///
+    /// \see transformPoints
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformVertices(Vertex* vertices, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Combine the current transform with another one
     ///
@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Block of uniform data in graphics memory, shared by shaders
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(UniformBuffer&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Allocates \p size bytes of graphics memory. Any previously
+    /// allocated memory is freed in the process. The size must
+    /// match the size of the uniform block in the shaders, laid
+    /// out according to the std140 rules.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer
+    ///
+    /// \return Size of the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer
+    ///
+    /// \p offset + \p size must not exceed the size of the
+    /// buffer, otherwise the update fails.
+    ///
+    /// \param data   Data to copy to the buffer
+    /// \param size   Number of bytes to copy
+    /// \param offset Offset in the buffer to copy to, in bytes
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t size, std::size_t offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports uniform buffers
+    ///
+    /// This function should always be called before using
+    /// the uniform buffer features. If it returns false, then
+    /// any attempt to use sf::UniformBuffer will fail.
+    ///
+    /// \return True if uniform buffers are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{}; //!< Internal buffer identifier
+    std::size_t  m_size{};   //!< Size in bytes of the currently allocated buffer
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// sf::UniformBuffer holds the values of a uniform block in
+/// graphics memory. A uniform block groups uniforms that are
+/// declared the same way in several shaders, for example the
+/// camera, the time and the lights of a scene:
+/// \code
+/// layout(std140) uniform Frame
+/// {
+///     mat4 camera;
+///     vec4 light;
+///     float time;
+/// };
+/// \endcode
+///
+/// The buffer is updated once, and every shader that the buffer
+/// is bound to with sf::Shader::bindUniformBlock sees the new
+/// values the next time it is used. This replaces setting the
+/// same uniforms on each shader, every frame.
+///
+/// The layout of the data is up to you; the simplest is to
+/// mirror the block with a C++ structure that follows the
+/// std140 rules (vec3 and vec4 members are 16 bytes aligned,
+/// matrices are made of 16 bytes columns).
+///
+/// Uniform blocks require GLSL 1.40 or the
+/// ARB_uniform_buffer_object extension, check isAvailable()
+/// before using this class.
+///
+/// Example:
+/// \code
+/// struct Frame
+/// {
+///     std::array<float, 16> camera;
+///     std::array<float, 4> light;
+///     float time;
+///     float padding[3];
+/// };
+///
+/// sf::UniformBuffer frameBuffer;
+/// if (!frameBuffer.create(sizeof(Frame)))
+///     return -1;
+///
+/// for (sf::Shader& shader : shaders)
+///     shader.bindUniformBlock("Frame", frameBuffer);
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     frame.time = clock.getElapsedTime().asSeconds();
+///     (void)frameBuffer.update(&frame, sizeof(frame));
+///
+///     // Every shader uses the new values
+///     window.draw(sprite, &shaders[0]);
+///     window.draw(shape, &shaders[1]);
+/// }
+/// \endcode
+///
+/// \see sf::Shader
+///
+////////////////////////////////////////////////////////////
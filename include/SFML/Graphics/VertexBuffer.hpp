@@ -35,6 +35,8 @@
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <array>
+
 #include <cstddef>
 
 
@@ -210,6 +212,51 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const VertexBuffer& vertexBuffer);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Map the buffer to write new vertices directly to graphics memory
+    ///
+    /// This function replaces the contents of the buffer with
+    /// \p vertexCount vertices and returns a pointer to them, so
+    /// that they can be written without an intermediate copy in
+    /// system memory. The previous contents are lost and the
+    /// returned vertices are uninitialized.
+    ///
+    /// The buffer is split into several regions which are used
+    /// in turn, so that writing the new vertices never waits
+    /// for the GPU to finish drawing the previous ones. Unless
+    /// \p vertexCount grows, no memory is allocated either. This
+    /// makes it the fastest way to refill a buffer every frame,
+    /// typically with the sf::VertexBuffer::Usage::Stream usage.
+    ///
+    /// unmap must be called once the vertices are written, and
+    /// before the buffer is drawn or updated again.
+    ///
+    /// Mapping is not supported with OpenGL ES.
+    ///
+    /// \param vertexCount Number of vertices to write
+    ///
+    /// \return Pointer to the vertices to write, or a null pointer on failure
+    ///
+    /// \see unmap
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vertex* map(std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmap the buffer after writing vertices to it
+    ///
+    /// In rare cases (e.g. a video mode change), the contents
+    /// of a mapped buffer can be lost, in which case this
+    /// function returns false and the vertices must be written
+    /// again.
+    ///
+    /// \return True if the vertices were written successfully
+    ///
+    /// \see map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool unmap();
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -322,6 +369,17 @@ public:
     static bool isAvailable();
 
 private:
+    friend class RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop cycling through the regions of the buffer
+    ///
+    /// This must be called when the buffer storage is reallocated
+    /// by anything other than map.
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetRegions();
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the vertex buffer to a render target
     ///
@@ -334,10 +392,17 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
+    static constexpr std::size_t RegionCount{3}; //!< Number of regions map cycles through
+
     unsigned int  m_buffer{};                             //!< Internal buffer identifier
     std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
     PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
     Usage         m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+
+    std::size_t                    m_regionSize{};   //!< Size in vertices of each region, 0 if not cycling
+    std::size_t                    m_region{};       //!< Index of the region holding the current vertices
+    std::size_t                    m_firstVertex{};  //!< Offset in vertices of the current vertices in the buffer
+    std::array<void*, RegionCount> m_regionFences{}; //!< Fences signaled once the GPU is done with each region
 };
 
 ////////////////////////////////////////////////////////////
@@ -395,6 +460,11 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// pending data transfers complete before the vertex buffer is sourced
 /// by the rendering pipeline.
 ///
+/// Buffers which are refilled every frame (e.g. particle systems)
+/// can be written to directly with map and unmap, which avoids
+/// both the intermediate copy in system memory and waiting for
+/// the GPU to finish drawing the previous frame.
+///
 /// It inherits sf::Drawable, but unlike other drawables it
 /// is not transformable.
 ///
@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/MiniaudioUtils.hpp>
 
 #include <SFML/System/Err.hpp>
 
@@ -71,9 +72,11 @@ AudioDevice::AudioDevice()
 
     auto contextConfig                                 = ma_context_config_init();
     contextConfig.pLog                                 = &*m_log;
+    contextConfig.allocationCallbacks                  = MiniaudioUtils::getAllocationCallbacks();
     ma_uint32                              deviceCount = 0;
     const auto                             nullBackend = ma_backend_null;
-    const std::array<const ma_backend*, 2> backendLists{nullptr, &nullBackend};
+    const auto                             forceNull   = MiniaudioUtils::isNullBackendForced();
+    const std::array<const ma_backend*, 2> backendLists{forceNull ? &nullBackend : nullptr, &nullBackend};
 
     for (const auto* backendList : backendLists)
     {
@@ -141,10 +144,11 @@ AudioDevice::AudioDevice()
     }
 
     // Create the engine
-    auto engineConfig          = ma_engine_config_init();
-    engineConfig.pContext      = &*m_context;
-    engineConfig.pDevice       = &*m_playbackDevice;
-    engineConfig.listenerCount = 1;
+    auto engineConfig                = ma_engine_config_init();
+    engineConfig.pContext            = &*m_context;
+    engineConfig.pDevice             = &*m_playbackDevice;
+    engineConfig.listenerCount       = 1;
+    engineConfig.allocationCallbacks = MiniaudioUtils::getAllocationCallbacks();
 
     m_engine.emplace();
 
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundSource.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Effect processor shared with the audio thread
+///
+/// The audio thread only performs atomic operations to reach
+/// the processor: it never locks, allocates or destroys one.
+/// Replacing the processor waits until the audio thread is
+/// done with the previous one before destroying it.
+///
+////////////////////////////////////////////////////////////
+class EffectProcessorSlot
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    EffectProcessorSlot() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The audio thread must no longer use the slot.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~EffectProcessorSlot()
+    {
+        delete m_processor.load();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    EffectProcessorSlot(const EffectProcessorSlot&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    EffectProcessorSlot& operator=(const EffectProcessorSlot&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the effect processor
+    ///
+    /// Must not be called from the audio thread.
+    ///
+    /// \param effectProcessor New effect processor, empty to remove the current one
+    ///
+    ////////////////////////////////////////////////////////////
+    void set(SoundSource::EffectProcessor effectProcessor)
+    {
+        auto next = effectProcessor ? std::make_unique<SoundSource::EffectProcessor>(std::move(effectProcessor)) : nullptr;
+        const std::unique_ptr<SoundSource::EffectProcessor> previous(m_processor.exchange(next.release()));
+
+        // The audio thread may have loaded the previous processor just before the exchange
+        while (m_inUse)
+            std::this_thread::yield();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an effect processor is set
+    ///
+    /// \return True if an effect processor is set
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSet() const
+    {
+        return m_processor != nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the effect processor, if any (audio thread)
+    ///
+    /// \return True if an effect processor was called
+    ///
+    ////////////////////////////////////////////////////////////
+    bool process(const float*  inputFrames,
+                 unsigned int& inputFrameCount,
+                 float*        outputFrames,
+                 unsigned int& outputFrameCount,
+                 unsigned int  frameChannelCount)
+    {
+        m_inUse = true;
+
+        auto* processor = m_processor.load();
+
+        if (processor)
+            (*processor)(inputFrames, inputFrameCount, outputFrames, outputFrameCount, frameChannelCount);
+
+        m_inUse = false;
+        return processor != nullptr;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::atomic<SoundSource::EffectProcessor*> m_processor{}; //!< Current effect processor, null if none
+    std::atomic<bool>                          m_inUse{};     //!< True while the audio thread runs the processor
+};
+
+} // namespace sf::priv
@@ -26,7 +26,11 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/MiniaudioUtils.hpp>
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
+#ifdef SFML_AUDIO_TEST_HOOKS
+#include <SFML/Audio/TestHooks.hpp>
+#endif
 
 #include <SFML/System/Angle.hpp>
 #include <SFML/System/Err.hpp>
@@ -234,6 +238,20 @@ SoundChannel MiniaudioUtils::miniaudioChannelToSoundChannel(ma_channel soundChan
 }
 
 
+////////////////////////////////////////////////////////////
+ma_format MiniaudioUtils::sampleFormatToMiniaudioFormat(SampleFormat sampleFormat)
+{
+    switch (sampleFormat)
+    {
+        case SampleFormat::Int16:
+            return ma_format_s16;
+        default:
+            assert(sampleFormat == SampleFormat::Float32);
+            return ma_format_f32;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 Time MiniaudioUtils::getPlayingOffset(ma_sound& sound)
 {
@@ -267,6 +285,32 @@ ma_uint64 MiniaudioUtils::getFrameIndex(ma_sound& sound, Time timeOffset)
 }
 
 
+////////////////////////////////////////////////////////////
+bool MiniaudioUtils::isNullBackendForced()
+{
+#ifdef SFML_AUDIO_TEST_HOOKS
+    // Lets the tests run playback and capture on machines without audio hardware
+    return TestHooks::isNullBackendForced();
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+ma_allocation_callbacks MiniaudioUtils::getAllocationCallbacks()
+{
+#ifdef SFML_AUDIO_TEST_HOOKS
+    // Lets the tests observe miniaudio's allocations
+    if (const ma_allocation_callbacks* callbacks = TestHooks::getAllocationCallbacks())
+        return *callbacks;
+#endif
+
+    // Empty callbacks select miniaudio's default allocator
+    return {};
+}
+
+
 ////////////////////////////////////////////////////////////
 void MiniaudioUtils::reinitializeSound(ma_sound& sound, const std::function<void()>& initializeFn)
 {
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 
 #include <miniaudio.h>
@@ -46,8 +47,12 @@ namespace priv::MiniaudioUtils
 {
 [[nodiscard]] ma_channel   soundChannelToMiniaudioChannel(SoundChannel soundChannel);
 [[nodiscard]] SoundChannel miniaudioChannelToSoundChannel(ma_channel soundChannel);
+[[nodiscard]] ma_format    sampleFormatToMiniaudioFormat(SampleFormat sampleFormat);
 [[nodiscard]] Time         getPlayingOffset(ma_sound& sound);
 [[nodiscard]] ma_uint64    getFrameIndex(ma_sound& sound, Time timeOffset);
+[[nodiscard]] bool         isNullBackendForced();
+
+[[nodiscard]] ma_allocation_callbacks getAllocationCallbacks();
 
 void reinitializeSound(ma_sound& sound, const std::function<void()>& initializeFn);
 void initializeSound(const ma_data_source_vtable& vtable,
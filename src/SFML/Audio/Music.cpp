@@ -46,7 +46,7 @@ Music::~Music()
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromFile(const std::filesystem::path& filename)
+bool Music::openFromFile(const std::filesystem::path& filename, SampleFormat sampleFormat)
 {
     // First stop the music if it was already running
     stop();
@@ -56,14 +56,14 @@ bool Music::openFromFile(const std::filesystem::path& filename)
         return false;
 
     // Perform common initializations
-    initialize();
+    initialize(sampleFormat);
 
     return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
+bool Music::openFromMemory(const void* data, std::size_t sizeInBytes, SampleFormat sampleFormat)
 {
     // First stop the music if it was already running
     stop();
@@ -73,14 +73,14 @@ bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
         return false;
 
     // Perform common initializations
-    initialize();
+    initialize(sampleFormat);
 
     return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromStream(InputStream& stream)
+bool Music::openFromStream(InputStream& stream, SampleFormat sampleFormat)
 {
     // First stop the music if it was already running
     stop();
@@ -90,7 +90,7 @@ bool Music::openFromStream(InputStream& stream)
         return false;
 
     // Perform common initializations
-    initialize();
+    initialize(sampleFormat);
 
     return true;
 }
@@ -174,7 +174,7 @@ bool Music::onGetData(SoundStream::Chunk& data)
 {
     const std::lock_guard lock(m_mutex);
 
-    std::size_t         toFill        = m_samples.size();
+    std::size_t         toFill        = std::max(m_samples.size(), m_floatSamples.size());
     std::uint64_t       currentOffset = m_file.getSampleOffset();
     const std::uint64_t loopEnd       = m_loopSpan.offset + m_loopSpan.length;
 
@@ -184,9 +184,17 @@ bool Music::onGetData(SoundStream::Chunk& data)
     if (getLoop() && (m_loopSpan.length != 0) && (currentOffset <= loopEnd) && (currentOffset + toFill > loopEnd))
         toFill = static_cast<std::size_t>(loopEnd - currentOffset);
 
-    // Fill the chunk parameters
-    data.samples     = m_samples.data();
-    data.sampleCount = static_cast<std::size_t>(m_file.read(m_samples.data(), toFill));
+    // Fill the chunk parameters, decoding straight to floats if the stream uses them
+    if (getSampleFormat() == SampleFormat::Float32)
+    {
+        data.floatSamples = m_floatSamples.data();
+        data.sampleCount  = static_cast<std::size_t>(m_file.readFloat(m_floatSamples.data(), toFill));
+    }
+    else
+    {
+        data.samples     = m_samples.data();
+        data.sampleCount = static_cast<std::size_t>(m_file.read(m_samples.data(), toFill));
+    }
     currentOffset += data.sampleCount;
 
     // Check if we have stopped obtaining samples or reached either the EOF or the loop end point
@@ -227,17 +235,19 @@ std::optional<std::uint64_t> Music::onLoop()
 
 
 ////////////////////////////////////////////////////////////
-void Music::initialize()
+void Music::initialize(SampleFormat sampleFormat)
 {
     // Compute the music positions
     m_loopSpan.offset = 0;
     m_loopSpan.length = m_file.getSampleCount();
 
-    // Resize the internal buffer so that it can contain 1 second of audio samples
-    m_samples.resize(m_file.getSampleRate() * m_file.getChannelCount());
+    // Resize the internal buffer of the requested format so that it can contain 1 second of audio samples
+    const std::size_t bufferSize = m_file.getSampleRate() * m_file.getChannelCount();
+    m_samples.resize(sampleFormat == SampleFormat::Int16 ? bufferSize : 0);
+    m_floatSamples.resize(sampleFormat == SampleFormat::Float32 ? bufferSize : 0);
 
     // Initialize the stream
-    SoundStream::initialize(m_file.getChannelCount(), m_file.getSampleRate(), m_file.getChannelMap());
+    SoundStream::initialize(m_file.getChannelCount(), m_file.getSampleRate(), m_file.getChannelMap(), sampleFormat);
 }
 
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Fixed-capacity single-producer single-consumer ring buffer
+///
+/// One thread may write while another one reads, without any
+/// lock and without allocating. Read and write indices grow
+/// monotonically, which makes them usable as stable positions
+/// in the stream of elements written so far.
+///
+/// T must be trivially copyable.
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+class RingBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the capacity and drop all the stored elements
+    ///
+    /// Must not be called while another thread accesses the buffer.
+    ///
+    /// \param capacity New capacity, in elements
+    ///
+    ////////////////////////////////////////////////////////////
+    void resize(std::size_t capacity)
+    {
+        m_buffer.resize(capacity);
+        m_readIndex.store(0, std::memory_order_relaxed);
+        m_writeIndex.store(0, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the capacity of the buffer
+    ///
+    /// \return Maximum number of elements the buffer can hold
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCapacity() const
+    {
+        return m_buffer.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of elements that can be read (consumer side)
+    ///
+    /// \return Number of elements available for reading
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getReadAvailable() const
+    {
+        return static_cast<std::size_t>(m_writeIndex.load(std::memory_order_acquire) -
+                                        m_readIndex.load(std::memory_order_relaxed));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of elements that can be written (producer side)
+    ///
+    /// \return Number of free slots
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getWriteAvailable() const
+    {
+        return m_buffer.size() - static_cast<std::size_t>(m_writeIndex.load(std::memory_order_relaxed) -
+                                                          m_readIndex.load(std::memory_order_acquire));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total number of elements consumed so far
+    ///
+    /// \return Read index
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getReadIndex() const
+    {
+        return m_readIndex.load(std::memory_order_acquire);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total number of elements produced so far
+    ///
+    /// \return Write index
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getWriteIndex() const
+    {
+        return m_writeIndex.load(std::memory_order_acquire);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write elements to the buffer (producer side)
+    ///
+    /// \param data  Elements to write
+    /// \param count Number of elements to write
+    ///
+    /// \return Number of elements actually written
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t write(const T* data, std::size_t count)
+    {
+        count = std::min(count, getWriteAvailable());
+
+        const std::uint64_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+        const std::size_t   offset     = static_cast<std::size_t>(writeIndex % m_buffer.size());
+        const std::size_t   firstPart  = std::min(count, m_buffer.size() - offset);
+
+        std::memcpy(m_buffer.data() + offset, data, firstPart * sizeof(T));
+        std::memcpy(m_buffer.data(), data + firstPart, (count - firstPart) * sizeof(T));
+
+        m_writeIndex.store(writeIndex + count, std::memory_order_release);
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read elements from the buffer (consumer side)
+    ///
+    /// \param data  Destination of the elements
+    /// \param count Number of elements to read
+    ///
+    /// \return Number of elements actually read
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t read(T* data, std::size_t count)
+    {
+        count = std::min(count, getReadAvailable());
+
+        const std::uint64_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+        const std::size_t   offset    = static_cast<std::size_t>(readIndex % m_buffer.size());
+        const std::size_t   firstPart = std::min(count, m_buffer.size() - offset);
+
+        std::memcpy(data, m_buffer.data() + offset, firstPart * sizeof(T));
+        std::memcpy(data + firstPart, m_buffer.data(), (count - firstPart) * sizeof(T));
+
+        m_readIndex.store(readIndex + count, std::memory_order_release);
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Drop the elements located before a given position (consumer side)
+    ///
+    /// Does nothing if the position was already consumed.
+    ///
+    /// \param index Write index up to which elements are dropped
+    ///
+    ////////////////////////////////////////////////////////////
+    void skipTo(std::uint64_t index)
+    {
+        const std::uint64_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+
+        if (index > readIndex)
+            m_readIndex.store(std::min(index, m_writeIndex.load(std::memory_order_acquire)), std::memory_order_release);
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<T>             m_buffer;       //!< Storage of the elements
+    std::atomic<std::uint64_t> m_readIndex{};  //!< Number of elements consumed so far
+    std::atomic<std::uint64_t> m_writeIndex{}; //!< Number of elements produced so far
+};
+
+} // namespace sf::priv
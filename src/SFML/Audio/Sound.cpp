@@ -26,6 +26,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/EffectProcessorSlot.hpp>
+#include <SFML/Audio/InputSoundFile.hpp>
 #include <SFML/Audio/MiniaudioUtils.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
@@ -35,10 +37,13 @@
 #include <miniaudio.h>
 
 #include <algorithm>
+#include <atomic>
 #include <ostream>
+#include <thread>
 #include <vector>
 
 #include <cassert>
+#include <cstddef>
 #include <cstring>
 
 
@@ -117,7 +122,7 @@ struct Sound::Impl
         effectNode.channelCount = nodeChannelCount;
 
         // Route the sound through the effect node depending on whether an effect processor is set
-        connectEffect(bool{effectProcessor});
+        connectEffect(effectProcessor.isSet());
 
         // Because we are providing a custom data source, we have to provide the channel map ourselves
         if (buffer && !buffer->getChannelMap().empty())
@@ -147,23 +152,20 @@ struct Sound::Impl
                                                 });
     }
 
-    void processEffect(const float** framesIn, ma_uint32& frameCountIn, float** framesOut, ma_uint32& frameCountOut) const
+    void processEffect(const float** framesIn, ma_uint32& frameCountIn, float** framesOut, ma_uint32& frameCountOut)
     {
-        // If a processor is set, call it
-        if (effectProcessor)
-        {
-            if (!framesIn)
-                frameCountIn = 0;
+        if (!framesIn)
+            frameCountIn = 0;
 
-            effectProcessor(framesIn ? framesIn[0] : nullptr, frameCountIn, framesOut[0], frameCountOut, effectNode.channelCount);
+        // If a processor is set, call it
+        const float* input = framesIn ? framesIn[0] : nullptr;
 
+        if (effectProcessor.process(input, frameCountIn, framesOut[0], frameCountOut, effectNode.channelCount))
             return;
-        }
 
         // Otherwise just pass the data through 1:1
         if (framesIn == nullptr)
         {
-            frameCountIn  = 0;
             frameCountOut = 0;
             return;
         }
@@ -215,6 +217,100 @@ struct Sound::Impl
         }
     }
 
+    void openDecoder()
+    {
+        if (decoderOpen || !buffer || buffer->getStorageMode() != SoundBuffer::StorageMode::Compressed)
+            return;
+
+        // Open our own decoder on the compressed data, only for as long as we play it
+        if (!decoder.openFromMemory(buffer->m_compressedData.data(), buffer->m_compressedData.size()))
+        {
+            err() << "Failed to open decoder for compressed sound buffer" << std::endl;
+            return;
+        }
+
+        // Position it where the decoded prefix ends, unless playback resumes past it
+        const std::uint64_t prefixCount = getPrefixCount();
+        decoderCursor = (cursor > prefixCount && cursor < buffer->getSampleCount()) ? cursor : prefixCount;
+        decoder.seek(decoderCursor);
+
+        decoderOpen = true;
+    }
+
+    void closeDecoder()
+    {
+        if (!decoderOpen)
+            return;
+
+        // The audio thread may have checked that the decoder is open just before
+        decoderOpen = false;
+        while (decoding)
+            std::this_thread::yield();
+
+        decoder.close();
+        decoderCursor = 0;
+    }
+
+    [[nodiscard]] std::uint64_t getPrefixCount() const
+    {
+        return buffer->getSampleFormat() == SampleFormat::Float32 ? buffer->m_floatSamples.size()
+                                                                  : buffer->m_samples.size();
+    }
+
+    [[nodiscard]] std::uint64_t readCompressed(void* samplesOut, std::uint64_t sampleCount)
+    {
+        const bool        isFloat     = buffer->getSampleFormat() == SampleFormat::Float32;
+        const std::size_t sampleSize  = isFloat ? sizeof(float) : sizeof(std::int16_t);
+        const auto        prefixCount = getPrefixCount();
+
+        auto*         output   = static_cast<std::byte*>(samplesOut);
+        std::uint64_t position = cursor;
+        std::uint64_t toRead   = sampleCount;
+
+        // Without decoder (e.g. while the sound is being stopped), only the prefix can be played
+        decoding             = true;
+        const bool canDecode = decoderOpen;
+
+        // Start with the decoded prefix, so that playback doesn't wait for the decoder
+        if (position < prefixCount)
+        {
+            const auto  count  = std::min(toRead, prefixCount - position);
+            const void* prefix = isFloat ? static_cast<const void*>(buffer->m_floatSamples.data() + position)
+                                         : static_cast<const void*>(buffer->m_samples.data() + position);
+            std::memcpy(output, prefix, static_cast<std::size_t>(count) * sampleSize);
+
+            output += count * sampleSize;
+            position += count;
+            toRead -= count;
+
+            // If the decoder was left elsewhere (e.g. at the end, after looping), move it back
+            // to the end of the prefix now, rather than when the prefix has been played
+            if (canDecode && (decoderCursor != prefixCount))
+            {
+                decoder.seek(prefixCount);
+                decoderCursor = prefixCount;
+            }
+        }
+
+        // Decode the rest, seeking only if the playing position moved since the last read
+        if (canDecode && (toRead > 0))
+        {
+            if (decoderCursor != position)
+            {
+                decoder.seek(position);
+                decoderCursor = position;
+            }
+
+            const auto count = isFloat ? decoder.readFloat(reinterpret_cast<float*>(output), toRead)
+                                       : decoder.read(reinterpret_cast<std::int16_t*>(output), toRead);
+            decoderCursor += count;
+            position += count;
+        }
+
+        decoding = false;
+        return position - cursor;
+    }
+
     static ma_result read(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead)
     {
         auto&       impl   = *static_cast<Impl*>(dataSource);
@@ -226,12 +322,26 @@ struct Sound::Impl
         // Determine how many frames we can read
         *framesRead = std::min<ma_uint64>(frameCount, (buffer->getSampleCount() - impl.cursor) / buffer->getChannelCount());
 
-        // Copy the samples to the output
-        const auto sampleCount = *framesRead * buffer->getChannelCount();
+        // Copy the samples to the output, in the format they are stored in
+        auto sampleCount = *framesRead * buffer->getChannelCount();
 
-        std::memcpy(framesOut,
-                    buffer->getSamples() + impl.cursor,
-                    static_cast<std::size_t>(sampleCount) * sizeof(buffer->getSamples()[0]));
+        if (buffer->getStorageMode() == SoundBuffer::StorageMode::Compressed)
+        {
+            sampleCount = impl.readCompressed(framesOut, sampleCount);
+            *framesRead = sampleCount / buffer->getChannelCount();
+        }
+        else if (buffer->getSampleFormat() == SampleFormat::Float32)
+        {
+            std::memcpy(framesOut,
+                        buffer->getFloatSamples() + impl.cursor,
+                        static_cast<std::size_t>(sampleCount) * sizeof(float));
+        }
+        else
+        {
+            std::memcpy(framesOut,
+                        buffer->getSamples() + impl.cursor,
+                        static_cast<std::size_t>(sampleCount) * sizeof(std::int16_t));
+        }
 
         impl.cursor += static_cast<std::size_t>(sampleCount);
 
@@ -266,7 +376,8 @@ struct Sound::Impl
         const auto* buffer = impl.buffer;
 
         // If we don't have valid values yet, initialize with defaults so sound creation doesn't fail
-        *format     = ma_format_s16;
+        *format     = priv::MiniaudioUtils::sampleFormatToMiniaudioFormat(
+            buffer ? buffer->getSampleFormat() : SampleFormat::Int16);
         *channels   = buffer && buffer->getChannelCount() ? buffer->getChannelCount() : 1;
         *sampleRate = buffer && buffer->getSampleRate() ? buffer->getSampleRate() : 44100;
 
@@ -318,15 +429,19 @@ struct Sound::Impl
     };
 
     ma_data_source_base dataSourceBase{}; //!< The struct that makes this object a miniaudio data source (must be first member)
-    ma_node_vtable          effectNodeVTable{}; //!< Vtable of the effect node
-    EffectNode              effectNode;         //!< The engine node that performs effect processing
-    std::vector<ma_channel> soundChannelMap; //!< The map of position in sample frame to sound channel (miniaudio channels)
-    ma_sound                sound{};         //!< The sound
-    std::size_t             cursor{};        //!< The current playing position
-    bool                    looping{};       //!< True if we are looping the sound
-    const SoundBuffer*      buffer{};        //!< Sound buffer bound to the source
-    Status                  status{Status::Stopped}; //!< The status
-    EffectProcessor         effectProcessor;         //!< The effect processor
+    ma_node_vtable            effectNodeVTable{}; //!< Vtable of the effect node
+    EffectNode                effectNode;         //!< The engine node that performs effect processing
+    std::vector<ma_channel>   soundChannelMap; //!< The map of position in sample frame to sound channel (miniaudio channels)
+    ma_sound                  sound{};         //!< The sound
+    std::size_t               cursor{};        //!< The current playing position
+    bool                      looping{};       //!< True if we are looping the sound
+    const SoundBuffer*        buffer{};        //!< Sound buffer bound to the source
+    InputSoundFile            decoder;         //!< Decoder of the buffer's data, open while a compressed buffer plays
+    std::atomic<bool>         decoderOpen{};   //!< True if the decoder is open
+    std::atomic<bool>         decoding{};      //!< True while the audio thread may use the decoder
+    std::uint64_t             decoderCursor{}; //!< Sample position of the decoder
+    Status                    status{Status::Stopped}; //!< The status
+    priv::EffectProcessorSlot effectProcessor;         //!< The effect processor
 };
 
 
@@ -364,6 +479,10 @@ void Sound::play()
     if (m_impl->status == Status::Playing)
         setPlayingOffset(Time::Zero);
 
+    // Compressed buffers are decoded by each sound, only while it plays; a sound
+    // that finished playing on its own still has its decoder and reuses it
+    m_impl->openDecoder();
+
     if (const ma_result result = ma_sound_start(&m_impl->sound); result != MA_SUCCESS)
     {
         err() << "Failed to start playing sound: " << ma_result_description(result) << std::endl;
@@ -401,6 +520,7 @@ void Sound::stop()
     {
         setPlayingOffset(Time::Zero);
         m_impl->status = Status::Stopped;
+        m_impl->closeDecoder();
     }
 }
 
@@ -449,8 +569,8 @@ void Sound::setPlayingOffset(Time timeOffset)
 ////////////////////////////////////////////////////////////
 void Sound::setEffectProcessor(EffectProcessor effectProcessor)
 {
-    m_impl->effectProcessor = std::move(effectProcessor);
-    m_impl->connectEffect(bool{m_impl->effectProcessor});
+    m_impl->effectProcessor.set(std::move(effectProcessor));
+    m_impl->connectEffect(m_impl->effectProcessor.isSet());
 }
 
 
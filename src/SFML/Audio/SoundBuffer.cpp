@@ -31,11 +31,20 @@
 #include <SFML/Audio/SoundBuffer.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/Utils.hpp>
 
+#include <miniaudio.h>
+
+#include <algorithm>
+#include <array>
 #include <exception>
 #include <ostream>
 #include <utility>
 
+#include <cstring>
+
 
 namespace sf
 {
@@ -43,8 +52,13 @@ namespace sf
 SoundBuffer::SoundBuffer(const SoundBuffer& copy)
 {
     // don't copy the attached sounds
-    m_samples  = copy.m_samples;
-    m_duration = copy.m_duration;
+    m_samples               = copy.m_samples;
+    m_floatSamples          = copy.m_floatSamples;
+    m_sampleFormat          = copy.m_sampleFormat;
+    m_storageMode           = copy.m_storageMode;
+    m_compressedData        = copy.m_compressedData;
+    m_compressedSampleCount = copy.m_compressedSampleCount;
+    m_duration              = copy.m_duration;
 
     // Update the internal buffer with the new samples
     if (!update(copy.getChannelCount(), copy.getSampleRate(), copy.getChannelMap()))
@@ -68,33 +82,35 @@ SoundBuffer::~SoundBuffer()
 
 
 ////////////////////////////////////////////////////////////
-std::optional<SoundBuffer> SoundBuffer::loadFromFile(const std::filesystem::path& filename)
+std::optional<SoundBuffer> SoundBuffer::loadFromFile(const std::filesystem::path& filename, SampleFormat sampleFormat)
 {
     InputSoundFile file;
     if (file.openFromFile(filename))
-        return initialize(file);
+        return initialize(file, sampleFormat);
     else
         return std::nullopt;
 }
 
 
 ////////////////////////////////////////////////////////////
-std::optional<SoundBuffer> SoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes)
+std::optional<SoundBuffer> SoundBuffer::loadFromMemory(const void*  data,
+                                                       std::size_t  sizeInBytes,
+                                                       SampleFormat sampleFormat)
 {
     InputSoundFile file;
     if (file.openFromMemory(data, sizeInBytes))
-        return initialize(file);
+        return initialize(file, sampleFormat);
     else
         return std::nullopt;
 }
 
 
 ////////////////////////////////////////////////////////////
-std::optional<SoundBuffer> SoundBuffer::loadFromStream(InputStream& stream)
+std::optional<SoundBuffer> SoundBuffer::loadFromStream(InputStream& stream, SampleFormat sampleFormat)
 {
     InputSoundFile file;
     if (file.openFromStream(stream))
-        return initialize(file);
+        return initialize(file, sampleFormat);
     else
         return std::nullopt;
 }
@@ -132,6 +148,104 @@ std::optional<SoundBuffer> SoundBuffer::loadFromSamples(
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::loadFromSamples(
+    const float*                     samples,
+    std::uint64_t                    sampleCount,
+    unsigned int                     channelCount,
+    unsigned int                     sampleRate,
+    const std::vector<SoundChannel>& channelMap)
+{
+    if (samples && sampleCount && channelCount && sampleRate && !channelMap.empty())
+    {
+        // Copy the new audio samples
+        SoundBuffer soundBuffer(std::vector<float>(samples, samples + sampleCount));
+
+        // Update the internal buffer with the new samples
+        if (!soundBuffer.update(channelCount, sampleRate, channelMap))
+            return std::nullopt;
+        return soundBuffer;
+    }
+    else
+    {
+        // Error...
+        err() << "Failed to load sound buffer from float samples ("
+              << "array: " << samples << ", "
+              << "count: " << sampleCount << ", "
+              << "channels: " << channelCount << ", "
+              << "samplerate: " << sampleRate << ")" << std::endl;
+
+        return std::nullopt;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::loadCompressedFromFile(const std::filesystem::path& filename,
+                                                               Time                         prefixDuration,
+                                                               SampleFormat                 sampleFormat)
+{
+    FileInputStream stream;
+    if (!stream.open(filename))
+    {
+        err() << "Failed to open sound file (couldn't open stream)\n" << formatDebugPathInfo(filename) << std::endl;
+        return std::nullopt;
+    }
+
+    return loadCompressedFromStream(stream, prefixDuration, sampleFormat);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::loadCompressedFromMemory(const void*  data,
+                                                                 std::size_t  sizeInBytes,
+                                                                 Time         prefixDuration,
+                                                                 SampleFormat sampleFormat)
+{
+    if (!data || !sizeInBytes)
+    {
+        err() << "Failed to load compressed sound buffer from memory (no data)" << std::endl;
+        return std::nullopt;
+    }
+
+    // Keep our own copy of the file content
+    std::vector<std::byte> content(sizeInBytes);
+    std::memcpy(content.data(), data, sizeInBytes);
+
+    return initializeCompressed(std::move(content), prefixDuration, sampleFormat);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::loadCompressedFromStream(InputStream& stream,
+                                                                 Time         prefixDuration,
+                                                                 SampleFormat sampleFormat)
+{
+    // Read the whole content of the stream
+    const std::int64_t size = stream.getSize();
+    if (size <= 0)
+    {
+        err() << "Failed to load compressed sound buffer from stream (empty stream)" << std::endl;
+        return std::nullopt;
+    }
+
+    if (stream.seek(0) == -1)
+    {
+        err() << "Failed to seek sound stream" << std::endl;
+        return std::nullopt;
+    }
+
+    std::vector<std::byte> content(static_cast<std::size_t>(size));
+    if (stream.read(content.data(), size) != size)
+    {
+        err() << "Failed to read sound stream" << std::endl;
+        return std::nullopt;
+    }
+
+    return initializeCompressed(std::move(content), prefixDuration, sampleFormat);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
 {
@@ -140,7 +254,34 @@ bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
     if (file.openFromFile(filename, getSampleRate(), getChannelCount(), getChannelMap()))
     {
         // Write the samples to the opened file
-        file.write(m_samples.data(), m_samples.size());
+        if (m_storageMode == StorageMode::Compressed)
+        {
+            // Decode the whole file in small batches
+            InputSoundFile input;
+            if (!input.openFromMemory(m_compressedData.data(), m_compressedData.size()))
+                return false;
+
+            std::array<std::int16_t, 1024> buffer{};
+
+            while (const std::uint64_t count = input.read(buffer.data(), buffer.size()))
+                file.write(buffer.data(), count);
+        }
+        else if (m_sampleFormat == SampleFormat::Float32)
+        {
+            // Sound file writers take 16-bit samples, convert them in small batches
+            std::array<std::int16_t, 1024> buffer{};
+
+            for (std::size_t offset = 0; offset < m_floatSamples.size(); offset += buffer.size())
+            {
+                const std::size_t count = std::min(buffer.size(), m_floatSamples.size() - offset);
+                ma_pcm_f32_to_s16(buffer.data(), m_floatSamples.data() + offset, count, ma_dither_mode_none);
+                file.write(buffer.data(), count);
+            }
+        }
+        else
+        {
+            file.write(m_samples.data(), m_samples.size());
+        }
 
         return true;
     }
@@ -151,17 +292,49 @@ bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
 }
 
 
+////////////////////////////////////////////////////////////
+SampleFormat SoundBuffer::getSampleFormat() const
+{
+    return m_sampleFormat;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBuffer::StorageMode SoundBuffer::getStorageMode() const
+{
+    return m_storageMode;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBuffer::getMemoryUsage() const
+{
+    return m_samples.capacity() * sizeof(std::int16_t) + m_floatSamples.capacity() * sizeof(float) +
+           m_compressedData.capacity();
+}
+
+
 ////////////////////////////////////////////////////////////
 const std::int16_t* SoundBuffer::getSamples() const
 {
-    return m_samples.empty() ? nullptr : m_samples.data();
+    return (m_samples.empty() || m_storageMode == StorageMode::Compressed) ? nullptr : m_samples.data();
+}
+
+
+////////////////////////////////////////////////////////////
+const float* SoundBuffer::getFloatSamples() const
+{
+    return (m_floatSamples.empty() || m_storageMode == StorageMode::Compressed) ? nullptr : m_floatSamples.data();
 }
 
 
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundBuffer::getSampleCount() const
 {
-    return m_samples.size();
+    if (m_storageMode == StorageMode::Compressed)
+        return m_compressedSampleCount;
+
+    return m_sampleFormat == SampleFormat::Float32 ? m_floatSamples.size() : m_samples.size();
 }
 
 
@@ -199,6 +372,11 @@ SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
     SoundBuffer temp(right);
 
     std::swap(m_samples, temp.m_samples);
+    std::swap(m_floatSamples, temp.m_floatSamples);
+    std::swap(m_sampleFormat, temp.m_sampleFormat);
+    std::swap(m_storageMode, temp.m_storageMode);
+    std::swap(m_compressedData, temp.m_compressedData);
+    std::swap(m_compressedSampleCount, temp.m_compressedSampleCount);
     std::swap(m_sampleRate, temp.m_sampleRate);
     std::swap(m_channelMap, temp.m_channelMap);
     std::swap(m_duration, temp.m_duration);
@@ -215,25 +393,79 @@ SoundBuffer::SoundBuffer(std::vector<std::int16_t>&& samples) : m_samples(std::m
 
 
 ////////////////////////////////////////////////////////////
-std::optional<SoundBuffer> SoundBuffer::initialize(InputSoundFile& file)
+SoundBuffer::SoundBuffer(std::vector<float>&& samples) :
+m_floatSamples(std::move(samples)),
+m_sampleFormat(SampleFormat::Float32)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::initialize(InputSoundFile& file, SampleFormat sampleFormat)
 {
     // Retrieve the sound parameters
     const std::uint64_t sampleCount = file.getSampleCount();
 
-    // Read the samples from the provided file
-    std::vector<std::int16_t> samples(static_cast<std::size_t>(sampleCount));
-    if (file.read(samples.data(), sampleCount) == sampleCount)
+    // Read the samples from the provided file, in the requested format
+    if (sampleFormat == SampleFormat::Float32)
     {
+        std::vector<float> samples(static_cast<std::size_t>(sampleCount));
+        if (file.readFloat(samples.data(), sampleCount) != sampleCount)
+            return std::nullopt;
+
         // Update the internal buffer with the new samples
         SoundBuffer soundBuffer(std::move(samples));
         if (!soundBuffer.update(file.getChannelCount(), file.getSampleRate(), file.getChannelMap()))
             return std::nullopt;
         return soundBuffer;
     }
-    else
-    {
+
+    std::vector<std::int16_t> samples(static_cast<std::size_t>(sampleCount));
+    if (file.read(samples.data(), sampleCount) != sampleCount)
         return std::nullopt;
-    }
+
+    // Update the internal buffer with the new samples
+    SoundBuffer soundBuffer(std::move(samples));
+    if (!soundBuffer.update(file.getChannelCount(), file.getSampleRate(), file.getChannelMap()))
+        return std::nullopt;
+    return soundBuffer;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::initializeCompressed(std::vector<std::byte>&& data,
+                                                             Time                     prefixDuration,
+                                                             SampleFormat             sampleFormat)
+{
+    InputSoundFile file;
+    if (!file.openFromMemory(data.data(), data.size()))
+        return std::nullopt;
+
+    // Decode the prefix, rounded down to whole frames
+    const std::uint64_t sampleCount  = file.getSampleCount();
+    const std::uint64_t channelCount = file.getChannelCount();
+    const auto          prefixFrames = static_cast<std::uint64_t>(
+        std::max(prefixDuration.asSeconds(), 0.f) * static_cast<float>(file.getSampleRate()));
+    const std::uint64_t prefixCount = std::min(prefixFrames * channelCount, sampleCount);
+
+    const bool  isFloat = sampleFormat == SampleFormat::Float32;
+    SoundBuffer soundBuffer = isFloat ? SoundBuffer(std::vector<float>(static_cast<std::size_t>(prefixCount)))
+                                      : SoundBuffer(std::vector<std::int16_t>(static_cast<std::size_t>(prefixCount)));
+
+    const std::uint64_t readCount = isFloat ? file.readFloat(soundBuffer.m_floatSamples.data(), prefixCount)
+                                            : file.read(soundBuffer.m_samples.data(), prefixCount);
+    if (readCount != prefixCount)
+        return std::nullopt;
+
+    // The file content is only moved, so its address stays the same for the open file
+    soundBuffer.m_storageMode           = StorageMode::Compressed;
+    soundBuffer.m_compressedData        = std::move(data);
+    soundBuffer.m_compressedSampleCount = sampleCount;
+
+    // Update the internal buffer with the new samples
+    if (!soundBuffer.update(file.getChannelCount(), file.getSampleRate(), file.getChannelMap()))
+        return std::nullopt;
+    return soundBuffer;
 }
 
 
@@ -256,7 +488,7 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate, con
 
     // Compute the duration
     m_duration = seconds(
-        static_cast<float>(m_samples.size()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
+        static_cast<float>(getSampleCount()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
 
     // Now reattach the buffer to the sounds that use it
     for (Sound* soundPtr : sounds)
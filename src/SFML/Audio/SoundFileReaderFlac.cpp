@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <ostream>
+#include <type_traits>
 
 #include <cassert>
 #include <cstddef>
@@ -110,6 +111,21 @@ FLAC__bool streamEof(const FLAC__StreamDecoder*, void* clientData)
     return data->stream->tell() == data->stream->getSize();
 }
 
+template <typename T>
+T convertSample(std::int32_t sample);
+
+template <>
+std::int16_t convertSample(std::int32_t sample)
+{
+    return static_cast<std::int16_t>(sample >> 16);
+}
+
+template <>
+float convertSample(std::int32_t sample)
+{
+    return static_cast<float>(sample) / 2147483648.f;
+}
+
 FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*,
                                            const FLAC__Frame*       frame,
                                            const FLAC__int32* const buffer[],
@@ -127,21 +143,21 @@ FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*,
     {
         for (unsigned int j = 0; j < frame->header.channels; ++j)
         {
-            // Decode the current sample
-            std::int16_t sample = 0;
+            // Decode the current sample, scaled to the full 32-bit range so that no precision is lost
+            std::int32_t sample = 0;
             switch (frame->header.bits_per_sample)
             {
                 case 8:
-                    sample = static_cast<std::int16_t>(buffer[j][i] << 8);
+                    sample = buffer[j][i] * (1 << 24);
                     break;
                 case 16:
-                    sample = static_cast<std::int16_t>(buffer[j][i]);
+                    sample = buffer[j][i] * (1 << 16);
                     break;
                 case 24:
-                    sample = static_cast<std::int16_t>(buffer[j][i] >> 8);
+                    sample = buffer[j][i] * (1 << 8);
                     break;
                 case 32:
-                    sample = static_cast<std::int16_t>(buffer[j][i] >> 16);
+                    sample = buffer[j][i];
                     break;
                 default:
                     assert(false && "Invalid bits per sample. Must be 8, 16, 24, or 32.");
@@ -150,8 +166,13 @@ FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*,
 
             if (data->buffer && data->remaining > 0)
             {
-                // If there's room in the output buffer, copy the sample there
-                *data->buffer++ = sample;
+                // If there's room in the output buffer, convert the sample there
+                *data->buffer++ = convertSample<std::int16_t>(sample);
+                --data->remaining;
+            }
+            else if (data->floatBuffer && data->remaining > 0)
+            {
+                *data->floatBuffer++ = convertSample<float>(sample);
                 --data->remaining;
             }
             else
@@ -246,6 +267,62 @@ void streamError(const FLAC__StreamDecoder*, FLAC__StreamDecoderErrorStatus, voi
     auto* data  = static_cast<sf::priv::SoundFileReaderFlac::ClientData*>(clientData);
     data->error = true;
 }
+
+template <typename T>
+std::uint64_t readSamples(FLAC__StreamDecoder*                        decoder,
+                          sf::priv::SoundFileReaderFlac::ClientData& clientData,
+                          T*                                          samples,
+                          std::uint64_t                               maxCount)
+{
+    // If there are leftovers from previous call, use it first
+    const std::size_t left = clientData.leftovers.size();
+    if (left > 0)
+    {
+        if (left > maxCount)
+        {
+            // There are more leftovers than needed
+            const auto end = clientData.leftovers.begin() +
+                             static_cast<std::vector<std::int32_t>::difference_type>(maxCount);
+            std::transform(clientData.leftovers.begin(), end, samples, &convertSample<T>);
+            clientData.leftovers.erase(clientData.leftovers.begin(), end);
+            return maxCount;
+        }
+        else
+        {
+            // We can use all the leftovers and decode new frames
+            std::transform(clientData.leftovers.begin(), clientData.leftovers.end(), samples, &convertSample<T>);
+        }
+    }
+
+    // Reset the data that will be used in the callback
+    if constexpr (std::is_same_v<T, float>)
+    {
+        clientData.buffer      = nullptr;
+        clientData.floatBuffer = samples + left;
+    }
+    else
+    {
+        clientData.buffer      = samples + left;
+        clientData.floatBuffer = nullptr;
+    }
+    clientData.remaining = maxCount - left;
+    clientData.leftovers.clear();
+
+    // Decode frames one by one until we reach the requested sample count, the end of file or an error
+    while (clientData.remaining > 0)
+    {
+        // Everything happens in the "write" callback
+        // This will break on any fatal error (does not include EOF)
+        if (!FLAC__stream_decoder_process_single(decoder))
+            break;
+
+        // Break on EOF
+        if (FLAC__stream_decoder_get_state(decoder) == FLAC__STREAM_DECODER_END_OF_STREAM)
+            break;
+    }
+
+    return maxCount - clientData.remaining;
+}
 } // namespace
 
 namespace sf::priv
@@ -335,8 +412,9 @@ void SoundFileReaderFlac::seek(std::uint64_t sampleOffset)
     assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
     // Reset the callback data (the "write" callback will be called)
-    m_clientData.buffer    = nullptr;
-    m_clientData.remaining = 0;
+    m_clientData.buffer      = nullptr;
+    m_clientData.floatBuffer = nullptr;
+    m_clientData.remaining   = 0;
     m_clientData.leftovers.clear();
 
     // FLAC decoder expects absolute sample offset, so we take the channel count out
@@ -364,48 +442,16 @@ std::uint64_t SoundFileReaderFlac::read(std::int16_t* samples, std::uint64_t max
 {
     assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
-    // If there are leftovers from previous call, use it first
-    const std::size_t left = m_clientData.leftovers.size();
-    if (left > 0)
-    {
-        if (left > maxCount)
-        {
-            // There are more leftovers than needed
-            std::copy(m_clientData.leftovers.begin(),
-                      m_clientData.leftovers.begin() + static_cast<std::vector<std::int16_t>::difference_type>(maxCount),
-                      samples);
-            std::vector<std::int16_t> leftovers(m_clientData.leftovers.begin() +
-                                                    static_cast<std::vector<std::int16_t>::difference_type>(maxCount),
-                                                m_clientData.leftovers.end());
-            m_clientData.leftovers.swap(leftovers);
-            return maxCount;
-        }
-        else
-        {
-            // We can use all the leftovers and decode new frames
-            std::copy(m_clientData.leftovers.begin(), m_clientData.leftovers.end(), samples);
-        }
-    }
-
-    // Reset the data that will be used in the callback
-    m_clientData.buffer    = samples + left;
-    m_clientData.remaining = maxCount - left;
-    m_clientData.leftovers.clear();
+    return readSamples(m_decoder.get(), m_clientData, samples, maxCount);
+}
 
-    // Decode frames one by one until we reach the requested sample count, the end of file or an error
-    while (m_clientData.remaining > 0)
-    {
-        // Everything happens in the "write" callback
-        // This will break on any fatal error (does not include EOF)
-        if (!FLAC__stream_decoder_process_single(m_decoder.get()))
-            break;
 
-        // Break on EOF
-        if (FLAC__stream_decoder_get_state(m_decoder.get()) == FLAC__STREAM_DECODER_END_OF_STREAM)
-            break;
-    }
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderFlac::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
-    return maxCount - m_clientData.remaining;
+    return readSamples(m_decoder.get(), m_clientData, samples, maxCount);
 }
 
 } // namespace sf::priv
@@ -214,6 +214,37 @@ std::uint64_t SoundFileReaderOgg::read(std::int16_t* samples, std::uint64_t maxC
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderOgg::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_vorbis.datasource && "Vorbis datasource is missing. Call SoundFileReaderOgg::open() to initialize it.");
+
+    // Vorbis decodes to planar floats, which only need to be interleaved
+    std::uint64_t count = 0;
+    while (count + m_channelCount <= maxCount)
+    {
+        float**    channels     = nullptr;
+        const int  framesToRead = static_cast<int>((maxCount - count) / m_channelCount);
+        const long framesRead   = ov_read_float(&m_vorbis, &channels, framesToRead, nullptr);
+        if (framesRead > 0)
+        {
+            for (long i = 0; i < framesRead; ++i)
+                for (unsigned int j = 0; j < m_channelCount; ++j)
+                    *samples++ = channels[j][i];
+
+            count += static_cast<std::uint64_t>(framesRead) * m_channelCount;
+        }
+        else
+        {
+            // error or end of file
+            break;
+        }
+    }
+
+    return count;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundFileReaderOgg::close()
 {
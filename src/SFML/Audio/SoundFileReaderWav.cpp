@@ -31,6 +31,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 
+#include <algorithm>
 #include <array>
 #include <ostream>
 #include <vector>
@@ -90,9 +91,10 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 bool SoundFileReaderWav::check(InputStream& stream)
 {
-    auto config           = ma_decoder_config_init_default();
-    config.encodingFormat = ma_encoding_format_wav;
-    config.format         = ma_format_s16;
+    auto config                = ma_decoder_config_init_default();
+    config.encodingFormat      = ma_encoding_format_wav;
+    config.format              = ma_format_s16;
+    config.allocationCallbacks = MiniaudioUtils::getAllocationCallbacks();
     ma_decoder decoder{};
 
     if (ma_decoder_init(&onRead, &onSeek, &stream, &config, &decoder) == MA_SUCCESS)
@@ -132,9 +134,11 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::open(InputStream& strea
         m_decoder.emplace();
     }
 
-    auto config           = ma_decoder_config_init_default();
-    config.encodingFormat = ma_encoding_format_wav;
-    config.format         = ma_format_s16;
+    // Decode to the format stored in the file, so that each read function can convert it on its own
+    auto config                = ma_decoder_config_init_default();
+    config.encodingFormat      = ma_encoding_format_wav;
+    config.format              = ma_format_unknown;
+    config.allocationCallbacks = MiniaudioUtils::getAllocationCallbacks();
 
     if (const ma_result result = ma_decoder_init(&onRead, &onSeek, &stream, &config, &*m_decoder); result != MA_SUCCESS)
     {
@@ -150,11 +154,10 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::open(InputStream& strea
         return std::nullopt;
     }
 
-    auto                       format = ma_format_unknown;
     ma_uint32                  sampleRate{};
     std::array<ma_channel, 20> channelMap{};
     if (const ma_result result = ma_decoder_get_data_format(&*m_decoder,
-                                                            &format,
+                                                            &m_format,
                                                             &m_channelCount,
                                                             &sampleRate,
                                                             channelMap.data(),
@@ -188,14 +191,68 @@ void SoundFileReaderWav::seek(std::uint64_t sampleOffset)
 
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundFileReaderWav::read(std::int16_t* samples, std::uint64_t maxCount)
+{
+    return readConverted(samples, ma_format_s16, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderWav::readFloat(float* samples, std::uint64_t maxCount)
+{
+    return readConverted(samples, ma_format_f32, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderWav::readConverted(void* samples, ma_format format, std::uint64_t maxCount)
 {
     assert(m_decoder && "wav decoder not initialized. Call SoundFileReaderWav::open() to initialize it.");
 
-    ma_uint64 framesRead{};
+    const ma_uint64 frameCount = maxCount / m_channelCount;
+    ma_uint64       framesRead{};
 
-    if (const ma_result result = ma_decoder_read_pcm_frames(&*m_decoder, samples, maxCount / m_channelCount, &framesRead);
-        result != MA_SUCCESS)
-        err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
+    // If the file already stores the requested format, decode straight into the output
+    if (format == m_format)
+    {
+        if (const ma_result result = ma_decoder_read_pcm_frames(&*m_decoder, samples, frameCount, &framesRead);
+            result != MA_SUCCESS)
+            err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
+
+        return framesRead * m_channelCount;
+    }
+
+    // Otherwise decode batches of frames in their original format and convert them
+    std::array<std::byte, 4096> buffer{};
+    const ma_uint32             inputFrameSize  = ma_get_bytes_per_frame(m_format, m_channelCount);
+    const ma_uint32             outputFrameSize = ma_get_bytes_per_frame(format, m_channelCount);
+    const ma_uint64             batchSize       = buffer.size() / inputFrameSize;
+    auto*                       output          = static_cast<std::byte*>(samples);
+
+    while (framesRead < frameCount)
+    {
+        const ma_uint64 framesToRead = std::min(frameCount - framesRead, batchSize);
+        ma_uint64       batchRead{};
+
+        const ma_result result = ma_decoder_read_pcm_frames(&*m_decoder, buffer.data(), framesToRead, &batchRead);
+
+        ma_pcm_convert(output + framesRead * outputFrameSize,
+                       format,
+                       buffer.data(),
+                       m_format,
+                       batchRead * m_channelCount,
+                       ma_dither_mode_none);
+        framesRead += batchRead;
+
+        if (result != MA_SUCCESS)
+        {
+            err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
+            break;
+        }
+
+        // Stop at the end of the file
+        if (batchRead < framesToRead)
+            break;
+    }
 
     return framesRead * m_channelCount;
 }
@@ -102,12 +102,36 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as 32-bit floats
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount) override;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples and convert them to the given format
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param format   Format of the samples to write to \a samples
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readConverted(void* samples, ma_format format, std::uint64_t maxCount);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::optional<ma_decoder> m_decoder;        //!< wav decoder
-    ma_uint32                 m_channelCount{}; //!< Number of channels
+    std::optional<ma_decoder> m_decoder;                  //!< wav decoder
+    ma_format                 m_format{ma_format_unknown}; //!< Format of the samples stored in the file
+    ma_uint32                 m_channelCount{};           //!< Number of channels
 };
 
 } // namespace sf::priv
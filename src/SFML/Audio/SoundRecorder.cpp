@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/MiniaudioUtils.hpp>
 #include <SFML/Audio/SoundRecorder.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -38,7 +39,6 @@
 #include <ostream>
 
 #include <cassert>
-#include <cstring>
 
 
 namespace sf
@@ -84,12 +84,8 @@ struct SoundRecorder::Impl
         {
             auto& impl = *static_cast<Impl*>(device->pUserData);
 
-            // Copy the new samples into our temporary buffer
-            impl.samples.resize(frameCount * impl.channelCount);
-            std::memcpy(impl.samples.data(), input, frameCount * impl.channelCount * sizeof(std::int16_t));
-
-            // Notify the derived class of the availability of new samples
-            if (!impl.owner->onProcessSamples(impl.samples.data(), impl.samples.size()))
+            // Notify the derived class of the availability of new samples, straight from the device buffer
+            if (!impl.owner->onProcessSamples(static_cast<const std::int16_t*>(input), frameCount * impl.channelCount))
             {
                 // If the derived class wants to stop, stop the capture
                 if (const auto result = ma_device_stop(device); result != MA_SUCCESS)
@@ -117,9 +113,12 @@ struct SoundRecorder::Impl
         // Create the context
         ma_context context;
 
-        const auto contextConfig = ma_context_config_init();
+        auto contextConfig                = ma_context_config_init();
+        contextConfig.allocationCallbacks = priv::MiniaudioUtils::getAllocationCallbacks();
+        const auto nullBackend            = ma_backend_null;
+        const auto backendList            = priv::MiniaudioUtils::isNullBackendForced() ? &nullBackend : nullptr;
 
-        if (const auto result = ma_context_init(nullptr, 0, &contextConfig, &context); result != MA_SUCCESS)
+        if (const auto result = ma_context_init(backendList, 1, &contextConfig, &context); result != MA_SUCCESS)
         {
             err() << "Failed to initialize the audio context: " << ma_result_description(result) << std::endl;
             return deviceList;
@@ -154,7 +153,6 @@ struct SoundRecorder::Impl
     std::string               deviceName{getDefaultDevice()}; //!< Name of the audio capture device
     unsigned int              channelCount{1};                //!< Number of recording channels
     unsigned int              sampleRate{44100};              //!< Sample rate
-    std::vector<std::int16_t> samples;                        //!< Buffer to store captured samples
     std::vector<SoundChannel> channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
 };
 
@@ -190,9 +188,11 @@ SoundRecorder::SoundRecorder() : m_impl(std::make_unique<Impl>(this))
 
     auto contextConfig                                 = ma_context_config_init();
     contextConfig.pLog                                 = &*m_impl->log;
+    contextConfig.allocationCallbacks                  = priv::MiniaudioUtils::getAllocationCallbacks();
     ma_uint32                              deviceCount = 0;
     const auto                             nullBackend = ma_backend_null;
-    const std::array<const ma_backend*, 2> backendLists{nullptr, &nullBackend};
+    const auto                             forceNull   = priv::MiniaudioUtils::isNullBackendForced();
+    const std::array<const ma_backend*, 2> backendLists{forceNull ? &nullBackend : nullptr, &nullBackend};
 
     for (const auto* backendList : backendLists)
     {
@@ -447,15 +447,26 @@ const std::vector<SoundChannel>& SoundRecorder::getChannelMap() const
 bool SoundRecorder::isAvailable()
 {
     // Try to open a device for capture to see if recording is available
+    auto contextConfig                = ma_context_config_init();
+    contextConfig.allocationCallbacks = priv::MiniaudioUtils::getAllocationCallbacks();
+    const auto nullBackend            = ma_backend_null;
+    const auto backendList            = priv::MiniaudioUtils::isNullBackendForced() ? &nullBackend : nullptr;
+    ma_context context;
+
+    // We can set backendCount to 1 since it is ignored when backends is set to nullptr
+    if (ma_context_init(backendList, 1, &contextConfig, &context) != MA_SUCCESS)
+        return false;
+
     const auto config = ma_device_config_init(ma_device_type_capture);
     ma_device  device;
+    const auto available = ma_device_init(&context, &config, &device) == MA_SUCCESS;
 
-    if (ma_device_init(nullptr, &config, &device) != MA_SUCCESS)
-        return false;
+    if (available)
+        ma_device_uninit(&device);
 
-    ma_device_uninit(&device);
+    ma_context_uninit(&context);
 
-    return true;
+    return available;
 }
 
 
@@ -26,7 +26,9 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/EffectProcessorSlot.hpp>
 #include <SFML/Audio/MiniaudioUtils.hpp>
+#include <SFML/Audio/RingBuffer.hpp>
 #include <SFML/Audio/SoundStream.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -35,10 +37,16 @@
 #include <miniaudio.h>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
 #include <ostream>
+#include <thread>
 #include <vector>
 
 #include <cassert>
+#include <cstddef>
 #include <cstring>
 
 
@@ -54,6 +62,8 @@ struct SoundStream::Impl
 
     ~Impl()
     {
+        stopDecoder();
+
         ma_sound_uninit(&sound);
         ma_node_uninit(&effectNode, nullptr);
         ma_data_source_uninit(&dataSourceBase);
@@ -118,7 +128,7 @@ struct SoundStream::Impl
         effectNode.channelCount = nodeChannelCount;
 
         // Route the sound through the effect node depending on whether an effect processor is set
-        connectEffect(bool{effectProcessor});
+        connectEffect(effectProcessor.isSet());
 
         // Because we are providing a custom data source, we have to provide the channel map ourselves
         if (!channelMap.empty())
@@ -148,22 +158,20 @@ struct SoundStream::Impl
                                                 });
     }
 
-    void processEffect(const float** framesIn, ma_uint32& frameCountIn, float** framesOut, ma_uint32& frameCountOut) const
+    void processEffect(const float** framesIn, ma_uint32& frameCountIn, float** framesOut, ma_uint32& frameCountOut)
     {
+        if (!framesIn)
+            frameCountIn = 0;
+
         // If a processor is set, call it
-        if (effectProcessor)
-        {
-            if (!framesIn)
-                frameCountIn = 0;
+        const float* input = framesIn ? framesIn[0] : nullptr;
 
-            effectProcessor(framesIn ? framesIn[0] : nullptr, frameCountIn, framesOut[0], frameCountOut, effectNode.channelCount);
+        if (effectProcessor.process(input, frameCountIn, framesOut[0], frameCountOut, effectNode.channelCount))
             return;
-        }
 
         // Otherwise just pass the data through 1:1
         if (framesIn == nullptr)
         {
-            frameCountIn  = 0;
             frameCountOut = 0;
             return;
         }
@@ -215,47 +223,280 @@ struct SoundStream::Impl
         }
     }
 
+    void startDecoder()
+    {
+        stopDecoder();
+
+        underrunCount = 0;
+
+        if (decodeAhead <= Time::Zero || channelCount == 0 || sampleRate == 0)
+            return;
+
+        // Size the ring so that it holds the requested duration, in whole frames
+        const auto frameCount = std::max<std::int64_t>(decodeAhead.asMicroseconds() * sampleRate / 1'000'000, 1);
+        ring.resize(static_cast<std::size_t>(frameCount) * channelCount * sampleSize);
+
+        pendingSamples     = nullptr;
+        pendingSize        = 0;
+        sourceExhausted    = false;
+        seekInProgress     = false;
+        pendingSeek        = noIndex;
+        discardIndex       = noIndex;
+        loopIndex          = noIndex;
+        endIndex           = noIndex;
+
+        // Fill the ring before playback starts so that the first callbacks don't underrun
+        fillRing();
+
+        const Time pollInterval = std::clamp(decodeAhead / std::int64_t{4}, milliseconds(1), milliseconds(10));
+
+        stopRequested     = false;
+        decodeAheadActive = true;
+        decoderThread     = std::thread([this, pollInterval] { runDecoder(pollInterval); });
+    }
+
+    void stopDecoder()
+    {
+        if (!decoderThread.joinable())
+            return;
+
+        {
+            const std::lock_guard lock(decoderMutex);
+            stopRequested = true;
+        }
+
+        decoderCondition.notify_one();
+        decoderThread.join();
+        decodeAheadActive = false;
+    }
+
+    void requestSeek(std::uint64_t frameIndex)
+    {
+        {
+            const std::lock_guard lock(decoderMutex);
+            pendingSeek = frameIndex;
+        }
+
+        decoderCondition.notify_one();
+    }
+
+    void runDecoder(Time pollInterval)
+    {
+        std::unique_lock lock(decoderMutex);
+
+        while (!stopRequested)
+        {
+            lock.unlock();
+            fillRing();
+            lock.lock();
+
+            // Wake up regularly to top up the ring, or immediately when a seek or a stop is requested
+            decoderCondition.wait_for(lock,
+                                      pollInterval.toDuration(),
+                                      [this] { return stopRequested || pendingSeek != noIndex; });
+        }
+    }
+
+    void performSeek(std::uint64_t frameIndex)
+    {
+        pendingSamples  = nullptr;
+        pendingSize     = 0;
+        sourceExhausted = false;
+        loopIndex       = noIndex;
+        endIndex        = noIndex;
+
+        owner->onSeek(seconds(static_cast<float>(frameIndex / sampleRate)));
+
+        // Everything written to the ring so far belongs to the old position
+        discardPosition = frameIndex * channelCount;
+        discardIndex    = ring.getWriteIndex();
+    }
+
+    void fillRing()
+    {
+        // The audio thread outputs silence from the moment a seek is requested until it is complete
+        if (pendingSeek != noIndex)
+        {
+            seekInProgress = true;
+            performSeek(pendingSeek.exchange(noIndex));
+        }
+
+        // Samples written after the audio thread dropped the stale ones can fill the whole ring
+        const bool staleSamplesDropped = discardIndex == noIndex;
+
+        while (endIndex == noIndex)
+        {
+            if (pendingSize == 0)
+            {
+                if (sourceExhausted)
+                {
+                    // Only one loop point can be in flight, wait for the audio thread to reach the previous one
+                    if (loopIndex != noIndex)
+                        break;
+
+                    if (loop)
+                    {
+                        if (const auto seekPositionAfterLoop = owner->onLoop())
+                        {
+                            loopPosition    = *seekPositionAfterLoop;
+                            loopIndex       = ring.getWriteIndex();
+                            sourceExhausted = false;
+                            continue;
+                        }
+                    }
+
+                    endIndex = ring.getWriteIndex();
+                    break;
+                }
+
+                Chunk chunk;
+                sourceExhausted = !owner->onGetData(chunk);
+
+                if (!setPendingChunk(chunk))
+                {
+                    // An empty chunk ends the stream, like in the synchronous mode
+                    if (!sourceExhausted)
+                        endIndex = ring.getWriteIndex();
+
+                    continue;
+                }
+            }
+
+            const std::size_t written = ring.write(pendingSamples, pendingSize);
+            pendingSamples += written;
+            pendingSize -= written;
+
+            // Stop once the ring is full
+            if (pendingSize != 0)
+                break;
+        }
+
+        // Let the audio thread resume once the ring is filled with samples following the seek
+        if (staleSamplesDropped)
+            seekInProgress = false;
+    }
+
+    void readDecodedSamples(std::byte* output, ma_uint64 frameCount, ma_uint64* framesRead)
+    {
+        // The ring stores raw bytes, so all the sizes below are in bytes
+        const std::size_t frameSize = channelCount * sampleSize;
+        const auto        requested = static_cast<std::size_t>(frameCount) * frameSize;
+
+        if (const std::uint64_t index = discardIndex.exchange(noIndex); index != noIndex)
+        {
+            ring.skipTo(index);
+            samplesProcessed = discardPosition.load();
+        }
+
+        // Don't play stale or partial data while the decoder thread handles a seek
+        if (seekInProgress || pendingSeek != noIndex)
+        {
+            std::memset(output, 0, requested);
+            *framesRead = frameCount;
+            return;
+        }
+
+        std::size_t done = 0;
+
+        while (done < requested)
+        {
+            // Load the available count first: the loop point is published after the samples that precede it
+            std::size_t   count  = std::min(requested - done, ring.getReadAvailable());
+            std::uint64_t loopAt = loopIndex;
+
+            if (loopAt != noIndex)
+            {
+                const std::uint64_t readIndex = ring.getReadIndex();
+
+                if (readIndex >= loopAt)
+                {
+                    // Reached the loop point, the following samples come from the beginning of the loop
+                    if (loopIndex.compare_exchange_strong(loopAt, noIndex))
+                        samplesProcessed = loopPosition.load();
+
+                    continue;
+                }
+
+                count = std::min(count, static_cast<std::size_t>(loopAt - readIndex));
+            }
+
+            if (count == 0)
+                break;
+
+            ring.read(output + done, count);
+            done += count;
+            samplesProcessed += count / sampleSize;
+        }
+
+        // Pad with silence unless the end of the stream was reached, in which case the short read ends the sound
+        if (done < requested && endIndex != ring.getReadIndex())
+        {
+            std::memset(output + done, 0, requested - done);
+            done = requested;
+
+            // Running dry because a seek started in the meantime is expected, not an underrun
+            if (!seekInProgress && pendingSeek == noIndex)
+                ++underrunCount;
+        }
+
+        *framesRead = done / frameSize;
+    }
+
+    bool setPendingChunk(const Chunk& chunk)
+    {
+        // Pick the samples matching the format of the stream
+        const void* samples = sampleFormat == SampleFormat::Float32 ? static_cast<const void*>(chunk.floatSamples)
+                                                                     : static_cast<const void*>(chunk.samples);
+
+        if (!samples || chunk.sampleCount == 0)
+            return false;
+
+        // Only keep whole frames
+        pendingSamples = static_cast<const std::byte*>(samples);
+        pendingSize    = (chunk.sampleCount - chunk.sampleCount % channelCount) * sampleSize;
+        return true;
+    }
+
     static ma_result read(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead)
     {
         auto& impl  = *static_cast<Impl*>(dataSource);
         auto* owner = impl.owner;
 
-        // Try to fill our buffer with new samples if the source is still willing to stream data
-        if (impl.sampleBuffer.empty() && impl.streaming)
+        // In decode-ahead mode, only copy the samples prepared by the decoder thread
+        if (impl.decodeAheadActive)
+        {
+            impl.readDecodedSamples(static_cast<std::byte*>(framesOut), frameCount, framesRead);
+            return MA_SUCCESS;
+        }
+
+        // Fetch a new chunk if the source is still willing to stream data; the source keeps ownership of the samples
+        if (impl.pendingSize == 0 && impl.streaming)
         {
             Chunk chunk;
 
             impl.streaming = owner->onGetData(chunk);
 
-            if (chunk.samples && chunk.sampleCount)
-            {
-                impl.sampleBuffer.assign(chunk.samples, chunk.samples + chunk.sampleCount);
-                impl.sampleBufferCursor = 0;
-            }
+            impl.setPendingChunk(chunk);
         }
 
         // Push the samples to miniaudio
-        if (!impl.sampleBuffer.empty())
+        if (impl.pendingSize != 0)
         {
             // Determine how many frames we can read
-            *framesRead = std::min<ma_uint64>(frameCount,
-                                              (impl.sampleBuffer.size() - impl.sampleBufferCursor) / impl.channelCount);
+            const std::size_t frameSize = impl.channelCount * impl.sampleSize;
+            *framesRead                 = std::min<ma_uint64>(frameCount, impl.pendingSize / frameSize);
 
-            const auto sampleCount = *framesRead * impl.channelCount;
+            const auto size = static_cast<std::size_t>(*framesRead) * frameSize;
 
             // Copy the samples to the output
-            std::memcpy(framesOut,
-                        impl.sampleBuffer.data() + impl.sampleBufferCursor,
-                        static_cast<std::size_t>(sampleCount) * sizeof(impl.sampleBuffer[0]));
+            std::memcpy(framesOut, impl.pendingSamples, size);
 
-            impl.sampleBufferCursor += static_cast<std::size_t>(sampleCount);
-            impl.samplesProcessed += sampleCount;
+            impl.pendingSamples += size;
+            impl.pendingSize -= size;
+            impl.samplesProcessed += *framesRead * impl.channelCount;
 
-            if (impl.sampleBufferCursor >= impl.sampleBuffer.size())
+            if (impl.pendingSize == 0)
             {
-                impl.sampleBuffer.clear();
-                impl.sampleBufferCursor = 0;
-
                 // If we are looping and at the end of the loop, set the cursor back to the beginning of the loop
                 if (!impl.streaming && impl.loop)
                 {
@@ -280,10 +521,18 @@ struct SoundStream::Impl
         auto& impl  = *static_cast<Impl*>(dataSource);
         auto* owner = impl.owner;
 
-        impl.streaming = true;
-        impl.sampleBuffer.clear();
-        impl.sampleBufferCursor = 0;
-        impl.samplesProcessed   = frameIndex * impl.channelCount;
+        // In decode-ahead mode, leave the seek to the decoder thread
+        if (impl.decodeAheadActive)
+        {
+            impl.samplesProcessed = frameIndex * impl.channelCount;
+            impl.pendingSeek      = frameIndex;
+            return MA_SUCCESS;
+        }
+
+        impl.streaming        = true;
+        impl.pendingSamples   = nullptr;
+        impl.pendingSize      = 0;
+        impl.samplesProcessed = frameIndex * impl.channelCount;
 
         if (impl.sampleRate != 0)
         {
@@ -307,7 +556,7 @@ struct SoundStream::Impl
         const auto& impl = *static_cast<const Impl*>(dataSource);
 
         // If we don't have valid values yet, initialize with defaults so sound creation doesn't fail
-        *format     = ma_format_s16;
+        *format     = priv::MiniaudioUtils::sampleFormatToMiniaudioFormat(impl.sampleFormat);
         *channels   = impl.channelCount ? impl.channelCount : 1;
         *sampleRate = impl.sampleRate ? impl.sampleRate : 44100;
 
@@ -352,16 +601,37 @@ struct SoundStream::Impl
     EffectNode              effectNode;         //!< The engine node that performs effect processing
     std::vector<ma_channel> soundChannelMap; //!< The map of position in sample frame to sound channel (miniaudio channels)
     ma_sound                sound{};         //!< The sound
-    std::vector<std::int16_t> sampleBuffer;            //!< Our temporary sample buffer
-    std::size_t               sampleBufferCursor{};    //!< The current read position in the temporary sample buffer
-    std::uint64_t             samplesProcessed{};      //!< Number of samples processed since beginning of the stream
-    unsigned int              channelCount{};          //!< Number of channels (1 = mono, 2 = stereo, ...)
-    unsigned int              sampleRate{};            //!< Frequency (samples / second)
-    std::vector<SoundChannel> channelMap{};            //!< The map of position in sample frame to sound channel
-    bool                      loop{};                  //!< Loop flag (true to loop, false to play once)
-    bool                      streaming{true};         //!< True if we are still streaming samples from the source
-    Status                    status{Status::Stopped}; //!< The status
-    EffectProcessor           effectProcessor;         //!< The effect processor
+    const std::byte*           pendingSamples{};        //!< Samples of the current chunk not consumed yet
+    std::size_t                pendingSize{};           //!< Size of the samples pointed by pendingSamples, in bytes
+    std::atomic<std::uint64_t> samplesProcessed{};      //!< Number of samples processed since beginning of the stream
+    unsigned int               channelCount{};          //!< Number of channels (1 = mono, 2 = stereo, ...)
+    unsigned int               sampleRate{};            //!< Frequency (samples / second)
+    std::vector<SoundChannel>  channelMap{};            //!< The map of position in sample frame to sound channel
+    SampleFormat               sampleFormat{};          //!< Format of the samples provided by the stream
+    std::size_t                sampleSize{};            //!< Size of a single sample, in bytes
+    std::atomic<bool>          loop{};                  //!< Loop flag (true to loop, false to play once)
+    bool                       streaming{true};         //!< True if we are still streaming samples from the source
+    Status                     status{Status::Stopped}; //!< The status
+    priv::EffectProcessorSlot  effectProcessor;         //!< The effect processor
+
+    static constexpr std::uint64_t noIndex{std::numeric_limits<std::uint64_t>::max()}; //!< Marker for "no index"
+
+    priv::RingBuffer<std::byte> ring;                  //!< Samples decoded ahead of playback
+    std::thread                 decoderThread;         //!< Thread filling the ring in decode-ahead mode
+    std::mutex                  decoderMutex;          //!< Mutex protecting stopRequested and seek requests
+    std::condition_variable     decoderCondition;      //!< Condition used to wake the decoder thread up
+    bool                        stopRequested{};       //!< True when the decoder thread must exit
+    Time                        decodeAhead;           //!< Requested decode-ahead duration (zero if disabled)
+    std::atomic<bool>           decodeAheadActive{};   //!< True while the decoder thread feeds the ring
+    bool                        sourceExhausted{};     //!< True once onGetData has returned false
+    std::atomic<bool>           seekInProgress{};      //!< True until the ring is refilled after a seek
+    std::atomic<std::uint64_t>  pendingSeek{noIndex};  //!< Frame to seek to, to be handled by the decoder thread
+    std::atomic<std::uint64_t>  discardIndex{noIndex}; //!< Ring index before which samples are stale after a seek
+    std::atomic<std::uint64_t>  discardPosition{};     //!< Sample position matching discardIndex
+    std::atomic<std::uint64_t>  loopIndex{noIndex};    //!< Ring index at which the stream loops
+    std::atomic<std::uint64_t>  loopPosition{};        //!< Sample position matching loopIndex
+    std::atomic<std::uint64_t>  endIndex{noIndex};     //!< Ring index at which the stream ends
+    std::atomic<std::uint64_t>  underrunCount{};       //!< Number of callbacks padded with silence
 };
 
 
@@ -376,11 +646,18 @@ SoundStream::~SoundStream() = default;
 
 
 ////////////////////////////////////////////////////////////
-void SoundStream::initialize(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap)
+void SoundStream::initialize(unsigned int                     channelCount,
+                             unsigned int                     sampleRate,
+                             const std::vector<SoundChannel>& channelMap,
+                             SampleFormat                     sampleFormat)
 {
+    m_impl->stopDecoder();
+
     m_impl->channelCount     = channelCount;
     m_impl->sampleRate       = sampleRate;
     m_impl->channelMap       = channelMap;
+    m_impl->sampleFormat     = sampleFormat;
+    m_impl->sampleSize       = sampleFormat == SampleFormat::Float32 ? sizeof(float) : sizeof(std::int16_t);
     m_impl->samplesProcessed = 0;
 
     m_impl->reinitialize();
@@ -392,6 +669,8 @@ void SoundStream::play()
 {
     if (m_impl->status == Status::Playing)
         setPlayingOffset(Time::Zero);
+    else if (m_impl->status == Status::Stopped)
+        m_impl->startDecoder();
 
     if (const ma_result result = ma_sound_start(&m_impl->sound); result != MA_SUCCESS)
     {
@@ -428,6 +707,7 @@ void SoundStream::stop()
     }
     else
     {
+        m_impl->stopDecoder();
         setPlayingOffset(Time::Zero);
         m_impl->status = Status::Stopped;
     }
@@ -455,6 +735,13 @@ std::vector<SoundChannel> SoundStream::getChannelMap() const
 }
 
 
+////////////////////////////////////////////////////////////
+SampleFormat SoundStream::getSampleFormat() const
+{
+    return m_impl->sampleFormat;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundStream::Status SoundStream::getStatus() const
 {
@@ -473,10 +760,17 @@ void SoundStream::setPlayingOffset(Time timeOffset)
 
     const auto frameIndex = priv::MiniaudioUtils::getFrameIndex(m_impl->sound, timeOffset);
 
-    m_impl->streaming = true;
-    m_impl->sampleBuffer.clear();
-    m_impl->sampleBufferCursor = 0;
-    m_impl->samplesProcessed   = frameIndex * m_impl->channelCount;
+    if (m_impl->decodeAheadActive)
+    {
+        m_impl->samplesProcessed = frameIndex * m_impl->channelCount;
+        m_impl->requestSeek(frameIndex);
+        return;
+    }
+
+    m_impl->streaming        = true;
+    m_impl->pendingSamples   = nullptr;
+    m_impl->pendingSize      = 0;
+    m_impl->samplesProcessed = frameIndex * m_impl->channelCount;
 
     onSeek(seconds(static_cast<float>(frameIndex / m_impl->sampleRate)));
 }
@@ -506,11 +800,32 @@ bool SoundStream::getLoop() const
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundStream::setDecodeAhead(Time duration)
+{
+    m_impl->decodeAhead = duration;
+}
+
+
+////////////////////////////////////////////////////////////
+Time SoundStream::getDecodeAhead() const
+{
+    return m_impl->decodeAhead;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundStream::getUnderrunCount() const
+{
+    return m_impl->underrunCount;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundStream::setEffectProcessor(EffectProcessor effectProcessor)
 {
-    m_impl->effectProcessor = std::move(effectProcessor);
-    m_impl->connectEffect(bool{m_impl->effectProcessor});
+    m_impl->effectProcessor.set(std::move(effectProcessor));
+    m_impl->connectEffect(m_impl->effectProcessor.isSet());
 }
 
 
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/TestHooks.hpp>
+
+#include <atomic>
+
+
+namespace
+{
+// Tests change the hooks while audio objects may be used by other threads
+std::atomic<bool>                           nullBackendForced{};
+std::atomic<const ma_allocation_callbacks*> allocationCallbacks{};
+} // namespace
+
+
+namespace sf::priv::TestHooks
+{
+////////////////////////////////////////////////////////////
+void setNullBackendForced(bool forced)
+{
+    nullBackendForced = forced;
+}
+
+
+////////////////////////////////////////////////////////////
+bool isNullBackendForced()
+{
+    return nullBackendForced;
+}
+
+
+////////////////////////////////////////////////////////////
+void setAllocationCallbacks(const ma_allocation_callbacks* callbacks)
+{
+    allocationCallbacks = callbacks;
+}
+
+
+////////////////////////////////////////////////////////////
+const ma_allocation_callbacks* getAllocationCallbacks()
+{
+    return allocationCallbacks;
+}
+
+} // namespace sf::priv::TestHooks
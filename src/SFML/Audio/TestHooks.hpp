@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <miniaudio.h>
+
+
+////////////////////////////////////////////////////////////
+/// Hooks letting the test suite control the audio devices.
+/// They are only compiled into sfml-audio when the test suite
+/// is built (SFML_BUILD_TEST_SUITE), and are not part of the
+/// public API.
+////////////////////////////////////////////////////////////
+namespace sf::priv::TestHooks
+{
+////////////////////////////////////////////////////////////
+/// \brief Force the audio devices onto miniaudio's null backend
+///
+/// When enabled, the audio devices and capture contexts
+/// created afterwards skip the system backends, so that
+/// playback and capture run without any audio hardware.
+///
+/// \param forced True to force the null backend, false to use the system backends
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void setNullBackendForced(bool forced);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether the null backend is forced
+///
+/// \return True if the null backend is forced
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API bool isNullBackendForced();
+
+////////////////////////////////////////////////////////////
+/// \brief Set the allocation callbacks passed to miniaudio
+///
+/// The callbacks are used by the miniaudio objects (contexts,
+/// engine, decoders) created afterwards. They let the tests
+/// observe the allocations made by miniaudio, e.g. to check
+/// that the audio thread doesn't allocate.
+/// The callbacks must remain valid until these objects are
+/// destroyed.
+///
+/// \param callbacks Allocation callbacks, nullptr to use miniaudio's default allocator
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void setAllocationCallbacks(const ma_allocation_callbacks* callbacks);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the allocation callbacks passed to miniaudio
+///
+/// \return Allocation callbacks, nullptr if miniaudio's default allocator is used
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API const ma_allocation_callbacks* getAllocationCallbacks();
+
+} // namespace sf::priv::TestHooks
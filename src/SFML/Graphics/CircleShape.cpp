@@ -29,11 +29,50 @@
 
 #include <SFML/System/Angle.hpp>
 
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace
+{
+// Get the points of a circle of radius 1, shared by all the circles having the same point count
+std::shared_ptr<const std::vector<sf::Vector2f>> getUnitPoints(std::size_t pointCount)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::size_t, std::weak_ptr<const std::vector<sf::Vector2f>>> cache;
+
+    const std::lock_guard lock(mutex);
+
+    if (const auto it = cache.find(pointCount); it != cache.end())
+        if (auto points = it->second.lock())
+            return points;
+
+    // Forget the point counts that are not used by any circle anymore
+    for (auto it = cache.begin(); it != cache.end();)
+        it = it->second.expired() ? cache.erase(it) : std::next(it);
+
+    auto points = std::make_shared<std::vector<sf::Vector2f>>(pointCount);
+    for (std::size_t i = 0; i < pointCount; ++i)
+    {
+        const sf::Angle angle = static_cast<float>(i) / static_cast<float>(pointCount) * sf::degrees(360.f) -
+                                sf::degrees(90.f);
+        (*points)[i] = sf::Vector2f(1.f, angle);
+    }
+
+    cache[pointCount] = points;
+    return points;
+}
+} // namespace
+
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-CircleShape::CircleShape(float radius, std::size_t pointCount) : m_radius(radius), m_pointCount(pointCount)
+CircleShape::CircleShape(float radius, std::size_t pointCount) :
+m_radius(radius),
+m_pointCount(pointCount),
+m_unitPoints(getUnitPoints(pointCount))
 {
     update();
 }
@@ -42,8 +81,16 @@ CircleShape::CircleShape(float radius, std::size_t pointCount) : m_radius(radius
 ////////////////////////////////////////////////////////////
 void CircleShape::setRadius(float radius)
 {
+    // The points of a circle are those of the unit circle multiplied by its
+    // radius, so a circle that keeps a positive radius is only scaled
+    const bool scaled = (m_radius > 0.f) && (radius > 0.f);
+
     m_radius = radius;
-    update();
+
+    if (scaled)
+        updateScaled();
+    else
+        update();
 }
 
 
@@ -57,7 +104,12 @@ float CircleShape::getRadius() const
 ////////////////////////////////////////////////////////////
 void CircleShape::setPointCount(std::size_t count)
 {
-    m_pointCount = count;
+    if (count != m_pointCount)
+    {
+        m_pointCount = count;
+        m_unitPoints = getUnitPoints(count);
+    }
+
     update();
 }
 
@@ -71,8 +123,8 @@ std::size_t CircleShape::getPointCount() const
 ////////////////////////////////////////////////////////////
 Vector2f CircleShape::getPoint(std::size_t index) const
 {
-    const Angle angle = static_cast<float>(index) / static_cast<float>(m_pointCount) * degrees(360.f) - degrees(90.f);
-    return Vector2f(m_radius, m_radius) + Vector2f(m_radius, angle);
+    // Scaling the cached unit circle avoids recomputing the trigonometry every time the radius changes
+    return Vector2f(m_radius, m_radius) + (*m_unitPoints)[index] * m_radius;
 }
 
 
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
@@ -42,7 +43,13 @@
 #include FT_BITMAP_H
 #include FT_STROKER_H
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
 #include <ostream>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 
 #include <cmath>
@@ -80,12 +87,340 @@ inline T reinterpret(const U& input)
     return output;
 }
 
+// Padding left around glyphs in the atlas, so that filtering doesn't
+// pollute them with pixels from neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Shader drawing distance field glyphs, with an optional outline whose thickness
+// is expressed as a fraction of the range of the distance field
+const char* const distanceFieldVertexShader = R"(
+void main()
+{
+    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+    gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;
+    gl_FrontColor = gl_Color;
+}
+)";
+
+const char* const distanceFieldFragmentShader = R"(
+uniform sampler2D texture;
+uniform float outlineThickness;
+uniform vec4 outlineColor;
+
+void main()
+{
+    float distance = texture2D(texture, gl_TexCoord[0].xy).a;
+    float smoothing = fwidth(distance);
+    float fill = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+
+    if (outlineThickness > 0.0)
+    {
+        float edge = 0.5 - outlineThickness;
+        float outline = smoothstep(edge - smoothing, edge + smoothing, distance);
+        vec4 color = mix(outlineColor, gl_Color, fill);
+        gl_FragColor = vec4(color.rgb, color.a * outline);
+    }
+    else
+    {
+        gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * fill);
+    }
+}
+)";
+
+// Number of glyphs under which starting another worker thread to rasterize them isn't worth it
+constexpr std::size_t glyphsPerWorker = 16;
+
 // Combine outline thickness, boldness and font glyph index into a single 64-bit key
 std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
 {
     return (static_cast<std::uint64_t>(reinterpret<std::uint32_t>(outlineThickness)) << 32) |
            (static_cast<std::uint64_t>(bold) << 31) | index;
 }
+// Resize a pixel buffer and fill it with transparent white pixels,
+// which are simply zero alpha values in alpha-only buffers
+void clearPixels(std::vector<std::uint8_t>& pixelBuffer, std::size_t pixelCount, bool alphaOnly)
+{
+    if (alphaOnly)
+    {
+        pixelBuffer.assign(pixelCount, 0);
+        return;
+    }
+
+    pixelBuffer.resize(pixelCount * 4);
+
+    std::uint8_t* current = pixelBuffer.data();
+    std::uint8_t* end     = current + pixelCount * 4;
+
+    while (current != end)
+    {
+        (*current++) = 255;
+        (*current++) = 255;
+        (*current++) = 255;
+        (*current++) = 0;
+    }
+}
+
+// Rasterize a glyph into an RGBA or alpha-only pixel buffer, with padding around it
+// The texture rectangle of the returned glyph only holds the size of the padded bitmap
+sf::Glyph rasterizeGlyph(FT_Library                 library,
+                         FT_Face                    face,
+                         FT_Stroker                 stroker,
+                         std::uint32_t              codePoint,
+                         bool                       bold,
+                         float                      outlineThickness,
+                         bool                       alphaOnly,
+                         std::vector<std::uint8_t>& pixelBuffer)
+{
+    // The glyph to return
+    sf::Glyph glyph;
+
+    // Load the glyph corresponding to the code point
+    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
+    if (outlineThickness != 0)
+        flags |= FT_LOAD_NO_BITMAP;
+    if (FT_Load_Char(face, codePoint, flags) != 0)
+        return glyph;
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc = nullptr;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return glyph;
+
+    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
+    const FT_Pos weight  = 1 << 6;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (outline)
+    {
+        if (bold)
+        {
+            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+        }
+
+        if (outlineThickness != 0)
+        {
+            FT_Stroker_Set(stroker,
+                           static_cast<FT_Fixed>(outlineThickness * static_cast<float>(1 << 6)),
+                           FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND,
+                           0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+        }
+    }
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    // Warning! After this line, do not read any data from glyphDesc directly, use
+    // bitmapGlyph.root to access the FT_Glyph data.
+    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
+    if (!outline)
+    {
+        if (bold)
+            FT_Bitmap_Embolden(library, &bitmap, weight, weight);
+
+        if (outlineThickness != 0)
+            sf::err() << "Failed to outline glyph (no fallback available)" << std::endl;
+    }
+
+    // Compute the glyph's advance offset
+    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        glyph.advance += static_cast<float>(weight) / static_cast<float>(1 << 6);
+
+    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    unsigned int width  = bitmap.width;
+    unsigned int height = bitmap.rows;
+
+    if ((width > 0) && (height > 0))
+    {
+        // Leave a small padding around characters
+        const unsigned int padding = glyphPadding;
+
+        width += 2 * padding;
+        height += 2 * padding;
+
+        // The texture rectangle is only known once the glyph is packed, store its size for now
+        glyph.textureRect.width  = static_cast<int>(width);
+        glyph.textureRect.height = static_cast<int>(height);
+
+        // Compute the glyph's bounding box
+        glyph.bounds.left   = static_cast<float>(bitmapGlyph->left);
+        glyph.bounds.top    = static_cast<float>(-bitmapGlyph->top);
+        glyph.bounds.width  = static_cast<float>(bitmap.width);
+        glyph.bounds.height = static_cast<float>(bitmap.rows);
+
+        // Resize the pixel buffer to the new size and fill it with transparent white pixels
+        clearPixels(pixelBuffer, static_cast<std::size_t>(width) * static_cast<std::size_t>(height), alphaOnly);
+
+        // The color channels remain white, just fill the alpha channel
+        const std::size_t bytesPerPixel = alphaOnly ? 1 : 4;
+        const std::size_t alphaOffset   = bytesPerPixel - 1;
+
+        // Extract the glyph's pixels from the bitmap
+        const std::uint8_t* pixels = bitmap.buffer;
+        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = padding; y < height - padding; ++y)
+            {
+                for (unsigned int x = padding; x < width - padding; ++x)
+                {
+                    const std::size_t index = x + y * width;
+                    const bool        isSet = (pixels[(x - padding) / 8] & (1 << (7 - ((x - padding) % 8)))) != 0;
+                    pixelBuffer[index * bytesPerPixel + alphaOffset] = isSet ? 255 : 0;
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bits gray levels
+            for (unsigned int y = padding; y < height - padding; ++y)
+            {
+                for (unsigned int x = padding; x < width - padding; ++x)
+                {
+                    const std::size_t index                          = x + y * width;
+                    pixelBuffer[index * bytesPerPixel + alphaOffset] = pixels[x - padding];
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+
+    return glyph;
+}
+
+// Scratch buffers of the one-dimensional distance transform
+struct DistanceTransformBuffers
+{
+    std::vector<float>       values;    //!< Input values of the line being transformed
+    std::vector<float>       bounds;    //!< Boundaries between the parabolas of the lower envelope
+    std::vector<std::size_t> parabolas; //!< Locations of the parabolas of the lower envelope
+};
+
+// Compute the squared euclidean distance transform of a line of a grid, in place,
+// following "Distance Transforms of Sampled Functions" (Felzenszwalb and Huttenlocher)
+void distanceTransformLine(std::vector<float>&       grid,
+                           std::size_t               offset,
+                           std::size_t               stride,
+                           std::size_t               length,
+                           DistanceTransformBuffers& buffers)
+{
+    auto& [values, bounds, parabolas] = buffers;
+    values.resize(length);
+    bounds.resize(length + 1);
+    parabolas.resize(length);
+
+    for (std::size_t i = 0; i < length; ++i)
+        values[i] = grid[offset + i * stride];
+
+    // Intersection of the parabolas rooted at q and r
+    const auto intersection = [&values](std::size_t q, std::size_t r)
+    {
+        const auto qf = static_cast<float>(q);
+        const auto rf = static_cast<float>(r);
+        return ((values[q] + qf * qf) - (values[r] + rf * rf)) / (2.f * (qf - rf));
+    };
+
+    // Compute the lower envelope of the parabolas
+    std::size_t k = 0;
+    parabolas[0]  = 0;
+    bounds[0]     = -std::numeric_limits<float>::infinity();
+    bounds[1]     = std::numeric_limits<float>::infinity();
+
+    for (std::size_t q = 1; q < length; ++q)
+    {
+        float s = intersection(q, parabolas[k]);
+        while (s <= bounds[k])
+            s = intersection(q, parabolas[--k]);
+
+        ++k;
+        parabolas[k]  = q;
+        bounds[k]     = s;
+        bounds[k + 1] = std::numeric_limits<float>::infinity();
+    }
+
+    // Sample the lower envelope
+    k = 0;
+    for (std::size_t q = 0; q < length; ++q)
+    {
+        while (bounds[k + 1] < static_cast<float>(q))
+            ++k;
+
+        const float distance      = static_cast<float>(q) - static_cast<float>(parabolas[k]);
+        grid[offset + q * stride] = distance * distance + values[parabolas[k]];
+    }
+}
+
+// Compute the squared euclidean distance transform of a grid, in place
+void distanceTransform(std::vector<float>&       grid,
+                       std::size_t               width,
+                       std::size_t               height,
+                       DistanceTransformBuffers& buffers)
+{
+    for (std::size_t x = 0; x < width; ++x)
+        distanceTransformLine(grid, x, width, height, buffers);
+
+    for (std::size_t y = 0; y < height; ++y)
+        distanceTransformLine(grid, y * width, 1, width, buffers);
+}
+
+// Replace the coverage of a rasterized glyph by a signed distance field, extended by
+// spread pixels on each side; the alpha channel stores 0.5 on the outline of the glyph,
+// and decreases linearly to 0 at spread pixels outside of it
+void computeDistanceField(sf::Glyph& glyph, std::vector<std::uint8_t>& pixelBuffer, bool alphaOnly, unsigned int spread)
+{
+    if ((glyph.textureRect.width <= 0) || (glyph.textureRect.height <= 0))
+        return;
+
+    const auto        sourceWidth   = static_cast<std::size_t>(glyph.textureRect.width);
+    const auto        sourceHeight  = static_cast<std::size_t>(glyph.textureRect.height);
+    const std::size_t width         = sourceWidth + 2 * spread;
+    const std::size_t height        = sourceHeight + 2 * spread;
+    const std::size_t bytesPerPixel = alphaOnly ? 1 : 4;
+    const std::size_t alphaOffset   = bytesPerPixel - 1;
+
+    // Mark the pixels inside and outside of the glyph
+    constexpr float    infinity = 1e20f;
+    std::vector<float> outside(width * height, infinity);
+    std::vector<float> inside(width * height, 0.f);
+    for (std::size_t y = 0; y < sourceHeight; ++y)
+    {
+        for (std::size_t x = 0; x < sourceWidth; ++x)
+        {
+            if (pixelBuffer[(x + y * sourceWidth) * bytesPerPixel + alphaOffset] >= 128)
+            {
+                const std::size_t index = (x + spread) + (y + spread) * width;
+                outside[index]          = 0.f;
+                inside[index]           = infinity;
+            }
+        }
+    }
+
+    // Compute the distance of each pixel to the nearest pixel on the other side of the outline
+    DistanceTransformBuffers buffers;
+    distanceTransform(outside, width, height, buffers);
+    distanceTransform(inside, width, height, buffers);
+
+    clearPixels(pixelBuffer, width * height, alphaOnly);
+    for (std::size_t i = 0; i < width * height; ++i)
+    {
+        const float distance = (inside[i] > 0.f) ? 0.5f - std::sqrt(inside[i]) : std::sqrt(outside[i]) - 0.5f;
+        const float value    = std::clamp(0.5f - distance / (2.f * static_cast<float>(spread)), 0.f, 1.f);
+        pixelBuffer[i * bytesPerPixel + alphaOffset] = static_cast<std::uint8_t>(std::lround(value * 255.f));
+    }
+
+    glyph.textureRect.width  = static_cast<int>(width);
+    glyph.textureRect.height = static_cast<int>(height);
+}
 } // namespace
 
 
@@ -108,6 +443,34 @@ struct Font::FontHandles
         FT_Done_FreeType(library);
     }
 
+    ////////////////////////////////////////////////////////////
+    // Open another instance of the font from the same source,
+    // so that it can be used by another thread
+    ////////////////////////////////////////////////////////////
+    bool open(const FontHandles& source)
+    {
+        if (FT_Init_FreeType(&library) != 0)
+            return false;
+
+        if (!source.filename.empty())
+        {
+            if (FT_New_Face(library, source.filename.string().c_str(), 0, &face) != 0)
+                return false;
+        }
+        else if (source.memoryData)
+        {
+            if (FT_New_Memory_Face(library, source.memoryData, source.memorySize, 0, &face) != 0)
+                return false;
+        }
+        else
+        {
+            // Streams can't be read by several faces at once
+            return false;
+        }
+
+        return (FT_Stroker_New(library, &stroker) == 0) && (FT_Select_Charmap(face, FT_ENCODING_UNICODE) == 0);
+    }
+
     // clang-format off
     FontHandles(const FontHandles&)            = delete;
     FontHandles& operator=(const FontHandles&) = delete;
@@ -120,6 +483,10 @@ struct Font::FontHandles
     FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
     FT_Face      face{};      //< Pointer to the internal font face
     FT_Stroker   stroker{};   //< Pointer to the stroker
+
+    std::filesystem::path filename;     //< Path of the font file, if loaded from a file
+    const FT_Byte*        memoryData{}; //< Pointer to the font data, if loaded from memory
+    FT_Long               memorySize{}; //< Size of the font data, if loaded from memory
 };
 
 
@@ -153,7 +520,8 @@ std::optional<Font> Font::loadFromFile(const std::filesystem::path& filename)
         err() << "Failed to load font (failed to create the font face)\n" << formatDebugPathInfo(filename) << std::endl;
         return std::nullopt;
     }
-    fontHandles->face = face;
+    fontHandles->face     = face;
+    fontHandles->filename = filename;
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -209,7 +577,9 @@ std::optional<Font> Font::loadFromMemory(const void* data, std::size_t sizeInByt
         err() << "Failed to load font from memory (failed to create the font face)" << std::endl;
         return std::nullopt;
     }
-    fontHandles->face = face;
+    fontHandles->face       = face;
+    fontHandles->memoryData = reinterpret_cast<const FT_Byte*>(data);
+    fontHandles->memorySize = static_cast<FT_Long>(sizeInBytes);
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -301,8 +671,58 @@ const Font::Info& Font::getInfo() const
 ////////////////////////////////////////////////////////////
 const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
-    // Get the page corresponding to the character size
-    GlyphTable& glyphs = loadPage(characterSize).glyphs;
+    return findGlyph(loadPage(characterSize), codePoint, characterSize, bold, outlineThickness);
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getDistanceFieldGlyph(std::uint32_t codePoint, bool bold) const
+{
+    return findGlyph(loadDistanceFieldPage(), codePoint, m_distanceFieldSize, bold, 0.f);
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::findGlyph(Page&         page,
+                             std::uint32_t codePoint,
+                             unsigned int  characterSize,
+                             bool          bold,
+                             float         outlineThickness) const
+{
+    // Fast path: code points of the Basic Multilingual Plane are looked up in a direct
+    // lookup table, which avoids both hashing and querying FreeType for the glyph index
+    std::uint32_t* lookupEntry = nullptr;
+    if (codePoint <= 0xFFFF)
+    {
+        GlyphLookupTable* table = nullptr;
+        for (auto& lookupTable : page.lookupTables)
+        {
+            if ((lookupTable.bold == bold) && (lookupTable.outlineThickness == outlineThickness))
+            {
+                table = &lookupTable;
+                break;
+            }
+        }
+
+        if (!table)
+        {
+            table                   = &page.lookupTables.emplace_back();
+            table->bold             = bold;
+            table->outlineThickness = outlineThickness;
+        }
+
+        std::vector<std::uint32_t>& block = table->blocks[codePoint >> 8];
+        if (block.empty())
+            block.resize(256);
+
+        lookupEntry = &block[codePoint & 0xFF];
+        if (*lookupEntry != 0)
+        {
+            GlyphSlot& glyphSlot = page.glyphs[*lookupEntry - 1];
+            glyphSlot.lastUse    = ++page.useCounter;
+            return glyphSlot.glyph;
+        }
+    }
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
     const std::uint64_t key = combine(outlineThickness,
@@ -310,17 +730,26 @@ const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize,
                                       FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
 
     // Search the glyph into the cache
-    if (const auto it = glyphs.find(key); it != glyphs.end())
+    std::size_t slot = 0;
+    if (const auto it = page.glyphSlots.find(key); it != page.glyphSlots.end())
     {
-        // Found: just return it
-        return it->second;
+        // Found: just use it
+        slot = it->second;
     }
     else
     {
         // Not found: we have to load it
-        const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-        return glyphs.emplace(key, glyph).first->second;
+        // Loading may evict other glyphs, so the slot is only chosen afterwards
+        slot = addGlyph(page, key, loadGlyph(page, codePoint, characterSize, bold, outlineThickness));
     }
+
+    page.glyphs[slot].lastUse = ++page.useCounter;
+
+    // Remember the slot so that the next lookup of this code point takes the fast path
+    if (lookupEntry)
+        *lookupEntry = static_cast<std::uint32_t>(slot + 1);
+
+    return page.glyphs[slot].glyph;
 }
 
 
@@ -332,60 +761,239 @@ bool Font::hasGlyph(std::uint32_t codePoint) const
 
 
 ////////////////////////////////////////////////////////////
-float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize, bool bold) const
+void Font::preloadGlyphs(const std::vector<std::pair<std::uint32_t, std::uint32_t>>& codePointRanges,
+                         unsigned int                                               characterSize,
+                         bool                                                       bold,
+                         float                                                      outlineThickness) const
 {
-    // Special case where first or second is 0 (null character)
-    if (first == 0 || second == 0)
-        return 0.f;
+    // Stop if no font is loaded
+    if (!m_fontHandles || !m_fontHandles->face)
+        return;
 
-    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    // Get the page corresponding to the character size
+    Page&      page      = loadPage(characterSize);
+    const bool alphaOnly = page.texture.m_alphaOnly;
 
-    if (face && setCurrentSize(characterSize))
+    // Gather the glyphs which are not in the cache yet
+    struct StagedGlyph
     {
-        // Convert the characters to indices
-        const FT_UInt index1 = FT_Get_Char_Index(face, first);
-        const FT_UInt index2 = FT_Get_Char_Index(face, second);
-
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
-        const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
+        std::uint32_t             codePoint{};  //!< Unicode code point of the glyph
+        std::uint64_t             key{};        //!< Key identifying the glyph in the page
+        bool                      rasterized{}; //!< Has the glyph been rasterized?
+        Glyph                     glyph;        //!< Glyph, whose texture rectangle holds the size of the bitmap
+        std::vector<std::uint8_t> pixels;       //!< Pixels of the padded bitmap
+    };
+
+    std::vector<StagedGlyph>          stagedGlyphs;
+    std::unordered_set<std::uint64_t> stagedKeys;
+    for (const auto& [first, last] : codePointRanges)
+    {
+        for (std::uint64_t codePoint = first; codePoint <= last; ++codePoint)
+        {
+            const auto          convertedCodePoint = static_cast<std::uint32_t>(codePoint);
+            const std::uint64_t key = combine(outlineThickness,
+                                              bold,
+                                              FT_Get_Char_Index(m_fontHandles->face, convertedCodePoint));
 
-        // Get the kerning vector if present
-        FT_Vector kerning{0, 0};
-        if (FT_HAS_KERNING(face))
-            FT_Get_Kerning(face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+            if ((page.glyphSlots.count(key) == 0) && stagedKeys.insert(key).second)
+            {
+                StagedGlyph& staged = stagedGlyphs.emplace_back();
+                staged.codePoint    = convertedCodePoint;
+                staged.key          = key;
+            }
+        }
+    }
 
-        // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(face))
-            return static_cast<float>(kerning.x);
+    if (stagedGlyphs.empty())
+        return;
 
-        // Combine kerning with compensation deltas and return the X advance
-        // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return std::floor(
-            (secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) / static_cast<float>(1 << 6));
-    }
-    else
+    // Rasterize the glyphs, each thread taking the next glyph which hasn't been processed yet
+    std::atomic<std::size_t> nextGlyph{0};
+    const auto rasterize = [&](FT_Library library, FT_Face face, FT_Stroker stroker)
     {
-        // Invalid font
-        return 0.f;
-    }
-}
+        for (std::size_t i = nextGlyph++; i < stagedGlyphs.size(); i = nextGlyph++)
+        {
+            StagedGlyph& staged = stagedGlyphs[i];
+            staged.glyph      = rasterizeGlyph(library,
+                                          face,
+                                          stroker,
+                                          staged.codePoint,
+                                          bold,
+                                          outlineThickness,
+                                          alphaOnly,
+                                          staged.pixels);
+            staged.rasterized = true;
+        }
+    };
 
+    // A FreeType face can't be used by several threads at once,
+    // so each worker thread opens its own instance of the font
+    if (!m_fontHandles->filename.empty() || m_fontHandles->memoryData)
+    {
+        const std::size_t threadCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u),
+                                                              (stagedGlyphs.size() + glyphsPerWorker - 1) /
+                                                                  glyphsPerWorker);
 
-////////////////////////////////////////////////////////////
-float Font::getLineSpacing(unsigned int characterSize) const
-{
-    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    FontHandles handles;
+                    if (handles.open(*m_fontHandles) && (FT_Set_Pixel_Sizes(handles.face, 0, characterSize) == 0))
+                        rasterize(handles.library, handles.face, handles.stroker);
+                });
+        }
 
-    if (face && setCurrentSize(characterSize))
-    {
-        return static_cast<float>(face->size->metrics.height) / static_cast<float>(1 << 6);
+        for (std::thread& thread : threads)
+            thread.join();
     }
-    else
+
+    // Rasterize the glyphs that couldn't be processed by worker threads on the calling thread
+    if ((nextGlyph < stagedGlyphs.size()) && setCurrentSize(characterSize))
+        rasterize(m_fontHandles->library, m_fontHandles->face, m_fontHandles->stroker);
+
+    // Pack the tallest glyphs first, so that rows are filled with glyphs of similar heights
+    std::vector<StagedGlyph*> packingOrder;
+    packingOrder.reserve(stagedGlyphs.size());
+    for (StagedGlyph& staged : stagedGlyphs)
     {
-        return 0.f;
+        if (staged.rasterized)
+            packingOrder.push_back(&staged);
     }
-}
+
+    std::stable_sort(packingOrder.begin(),
+                     packingOrder.end(),
+                     [](const StagedGlyph* left, const StagedGlyph* right)
+                     { return left->glyph.textureRect.height > right->glyph.textureRect.height; });
+
+    struct Upload
+    {
+        std::size_t                      slot{};   //!< Slot of the glyph in the page
+        std::uint64_t                    key{};    //!< Key identifying the glyph in the page
+        IntRect                          rect;     //!< Padded rectangle of the glyph in the texture
+        const std::vector<std::uint8_t>* pixels{}; //!< Pixels of the padded bitmap
+    };
+
+    std::vector<Upload> uploads;
+    uploads.reserve(packingOrder.size());
+    for (StagedGlyph* staged : packingOrder)
+    {
+        Glyph& glyph = staged->glyph;
+        if ((glyph.textureRect.width <= 0) || (glyph.textureRect.height <= 0))
+        {
+            addGlyph(page, staged->key, glyph);
+            continue;
+        }
+
+        // Find a good position for the new glyph into the texture
+        const Vector2i size = glyph.textureRect.getSize();
+        const IntRect  rect = findGlyphRect(page, Vector2u(size));
+
+        // Make sure the texture data is positioned in the center
+        // of the allocated texture rectangle
+        const auto padding = static_cast<int>(glyphPadding);
+        glyph.textureRect  = IntRect({rect.left + padding, rect.top + padding},
+                                    {rect.width - 2 * padding, rect.height - 2 * padding});
+
+        const std::size_t slot = addGlyph(page, staged->key, glyph);
+
+        // The glyph gets a placeholder rectangle if it doesn't fit in the texture at all
+        if (rect.getSize() == size)
+            uploads.push_back({slot, staged->key, rect, &staged->pixels});
+    }
+
+    // Packing the last glyphs may have evicted some of the first ones
+    uploads.erase(std::remove_if(uploads.begin(),
+                                 uploads.end(),
+                                 [&page](const Upload& upload)
+                                 {
+                                     const GlyphSlot& glyphSlot = page.glyphs[upload.slot];
+                                     return !glyphSlot.used || (glyphSlot.key != upload.key);
+                                 }),
+                  uploads.end());
+
+    std::sort(uploads.begin(),
+              uploads.end(),
+              [](const Upload& left, const Upload& right)
+              { return std::pair(left.rect.top, left.rect.left) < std::pair(right.rect.top, right.rect.left); });
+
+    // Write the pixels to the texture with a single update per run of adjacent glyphs in a row;
+    // the space left under the shorter glyphs of a row isn't used by any other glyph
+    for (std::size_t begin = 0; begin < uploads.size();)
+    {
+        const IntRect& first  = uploads[begin].rect;
+        int            height = first.height;
+
+        std::size_t end = begin + 1;
+        while ((end < uploads.size()) && (uploads[end].rect.top == first.top) &&
+               (uploads[end].rect.left == uploads[end - 1].rect.left + uploads[end - 1].rect.width))
+        {
+            height = std::max(height, uploads[end].rect.height);
+            ++end;
+        }
+
+        const IntRect& last  = uploads[end - 1].rect;
+        const auto     width = static_cast<std::size_t>(last.left + last.width - first.left);
+
+        // Resize the pixel buffer to the size of the run and fill it with transparent white pixels
+        clearPixels(m_pixelBuffer, width * static_cast<std::size_t>(height), alphaOnly);
+
+        // Copy the pixels of each glyph of the run
+        const std::size_t bytesPerPixel = alphaOnly ? 1 : 4;
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const IntRect&    rect     = uploads[i].rect;
+            const std::size_t rowBytes = static_cast<std::size_t>(rect.width) * bytesPerPixel;
+            const std::size_t offset   = static_cast<std::size_t>(rect.left - first.left) * bytesPerPixel;
+
+            const std::uint8_t* pixels = uploads[i].pixels->data();
+
+            for (std::size_t y = 0; y < static_cast<std::size_t>(rect.height); ++y)
+                std::memcpy(m_pixelBuffer.data() + y * width * bytesPerPixel + offset, pixels + y * rowBytes, rowBytes);
+        }
+
+        const Vector2u runSize(static_cast<unsigned int>(width), static_cast<unsigned int>(height));
+        if (alphaOnly)
+            page.texture.updateAlpha(m_pixelBuffer.data(), runSize, Vector2u(first.getPosition()));
+        else
+            page.texture.update(m_pixelBuffer.data(), runSize, Vector2u(first.getPosition()));
+
+        begin = end;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize, bool bold) const
+{
+    return findKerning(loadPage(characterSize), first, second, characterSize, bold);
+}
+
+
+////////////////////////////////////////////////////////////
+float Font::getDistanceFieldKerning(std::uint32_t first, std::uint32_t second, bool bold) const
+{
+    return findKerning(loadDistanceFieldPage(), first, second, m_distanceFieldSize, bold);
+}
+
+
+////////////////////////////////////////////////////////////
+float Font::getLineSpacing(unsigned int characterSize) const
+{
+    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+
+    if (face && setCurrentSize(characterSize))
+    {
+        return static_cast<float>(face->size->metrics.height) / static_cast<float>(1 << 6);
+    }
+    else
+    {
+        return 0.f;
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -436,6 +1044,40 @@ const Texture& Font::getTexture(unsigned int characterSize) const
     return loadPage(characterSize).texture;
 }
 
+
+////////////////////////////////////////////////////////////
+const Texture& Font::getDistanceFieldTexture() const
+{
+    return loadDistanceFieldPage().texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setDistanceFieldSize(unsigned int size)
+{
+    if (size != m_distanceFieldSize)
+    {
+        m_distanceFieldSize = size;
+
+        // The glyphs have to be rasterized again at the new size
+        m_distanceFieldPage.reset();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Font::getDistanceFieldSize() const
+{
+    return m_distanceFieldSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Font::getDistanceFieldSpread() const
+{
+    return std::max(m_distanceFieldSize / 8, 1u);
+}
+
 ////////////////////////////////////////////////////////////
 void Font::setSmooth(bool smooth)
 {
@@ -458,187 +1100,269 @@ bool Font::isSmooth() const
 
 
 ////////////////////////////////////////////////////////////
-Font::Page& Font::loadPage(unsigned int characterSize) const
+void Font::setAlphaOnlyAtlas(bool alphaOnly)
 {
-    return m_pages.try_emplace(characterSize, m_isSmooth).first->second;
+    if (alphaOnly != m_isAlphaOnlyAtlas)
+    {
+        m_isAlphaOnlyAtlas = alphaOnly;
+
+        // The pages have to be created again with the new format
+        m_pages.clear();
+        m_distanceFieldPage.reset();
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+bool Font::isAlphaOnlyAtlas() const
 {
-    // The glyph to return
-    Glyph glyph;
+    return m_isAlphaOnlyAtlas;
+}
 
-    // Stop if no font is loaded
-    if (!m_fontHandles)
-        return glyph;
 
-    // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
-    if (!face)
-        return glyph;
+////////////////////////////////////////////////////////////
+void Font::setMaximumAtlasSize(unsigned int size)
+{
+    m_maximumAtlasSize = size;
+}
 
-    // Set the character size
-    if (!setCurrentSize(characterSize))
-        return glyph;
 
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0)
-        flags |= FT_LOAD_NO_BITMAP;
-    if (FT_Load_Char(face, codePoint, flags) != 0)
-        return glyph;
+////////////////////////////////////////////////////////////
+unsigned int Font::getMaximumAtlasSize() const
+{
+    return m_maximumAtlasSize;
+}
 
-    // Retrieve the glyph
-    FT_Glyph glyphDesc = nullptr;
-    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
 
-    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
-    const FT_Pos weight  = 1 << 6;
-    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
-    if (outline)
-    {
-        if (bold)
-        {
-            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
-            FT_Outline_Embolden(&outlineGlyph->outline, weight);
-        }
+////////////////////////////////////////////////////////////
+Font::AtlasStats Font::getAtlasStats(unsigned int characterSize) const
+{
+    const Page& page = loadPage(characterSize);
 
-        if (outlineThickness != 0)
-        {
-            FT_Stroker stroker = m_fontHandles->stroker;
+    AtlasStats stats;
+    stats.size          = page.texture.getSize();
+    stats.glyphCount    = page.glyphs.size() - page.freeSlots.size();
+    stats.evictionCount = page.evictionCount;
 
-            FT_Stroker_Set(stroker,
-                           static_cast<FT_Fixed>(outlineThickness * static_cast<float>(1 << 6)),
-                           FT_STROKER_LINECAP_ROUND,
-                           FT_STROKER_LINEJOIN_ROUND,
-                           0);
-            FT_Glyph_Stroke(&glyphDesc, stroker, true);
-        }
-    }
+    const std::size_t textureArea = static_cast<std::size_t>(stats.size.x) * static_cast<std::size_t>(stats.size.y);
+    if (textureArea > 0)
+        stats.occupancy = static_cast<float>(page.allocatedArea) / static_cast<float>(textureArea);
 
-    // Convert the glyph to a bitmap (i.e. rasterize it)
-    // Warning! After this line, do not read any data from glyphDesc directly, use
-    // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
-    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
-    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+    return stats;
+}
 
-    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
-    if (!outline)
-    {
-        if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
 
-        if (outlineThickness != 0)
-            err() << "Failed to outline glyph (no fallback available)" << std::endl;
+////////////////////////////////////////////////////////////
+float Font::findKerning(Page&         page,
+                        std::uint32_t first,
+                        std::uint32_t second,
+                        unsigned int  characterSize,
+                        bool          bold) const
+{
+    // Special case where first or second is 0 (null character)
+    if (first == 0 || second == 0)
+        return 0.f;
+
+    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+
+    if (!face)
+    {
+        // Invalid font
+        return 0.f;
     }
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-        glyph.advance += static_cast<float>(weight) / static_cast<float>(1 << 6);
+    // Look the pair up in the kerning cache of the page first
+    KerningTable&       kernings = page.kernings[bold ? 1 : 0];
+    const std::uint64_t key      = (static_cast<std::uint64_t>(first) << 32) | second;
 
-    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+    if (const auto it = kernings.find(key); it != kernings.end())
+        return it->second;
 
-    unsigned int width  = bitmap.width;
-    unsigned int height = bitmap.rows;
+    if (!setCurrentSize(characterSize))
+        return 0.f;
 
-    if ((width > 0) && (height > 0))
+    // Convert the characters to indices
+    const FT_UInt index1 = FT_Get_Char_Index(face, first);
+    const FT_UInt index2 = FT_Get_Char_Index(face, second);
+
+    // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag,
+    // from the glyphs of the same page so that no other page gets rasterized
+    const auto firstRsbDelta  = static_cast<float>(findGlyph(page, first, characterSize, bold, 0.f).rsbDelta);
+    const auto secondLsbDelta = static_cast<float>(findGlyph(page, second, characterSize, bold, 0.f).lsbDelta);
+
+    // Get the kerning vector if present
+    FT_Vector kerning{0, 0};
+    if (FT_HAS_KERNING(face))
+        FT_Get_Kerning(face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+
+    float result = 0.f;
+
+    if (!FT_IS_SCALABLE(face))
+    {
+        // X advance is already in pixels for bitmap fonts
+        result = static_cast<float>(kerning.x);
+    }
+    else
     {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
+        // Combine kerning with compensation deltas and return the X advance
+        // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
+        result = std::floor(
+            (secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) / static_cast<float>(1 << 6));
+    }
 
-        width += 2 * padding;
-        height += 2 * padding;
+    kernings.emplace(key, result);
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::Page& Font::loadPage(unsigned int characterSize) const
+{
+    return m_pages.try_emplace(characterSize, m_isSmooth, m_isAlphaOnlyAtlas).first->second;
+}
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
 
+////////////////////////////////////////////////////////////
+Font::Page& Font::loadDistanceFieldPage() const
+{
+    // Distance fields are meaningless without bilinear filtering, so the page is always smooth
+    if (!m_distanceFieldPage)
+        m_distanceFieldPage.emplace(true, m_isAlphaOnlyAtlas, getDistanceFieldSpread());
+
+    return *m_distanceFieldPage;
+}
+
+
+////////////////////////////////////////////////////////////
+Glyph Font::loadGlyph(Page&         page,
+                      std::uint32_t codePoint,
+                      unsigned int  characterSize,
+                      bool          bold,
+                      float         outlineThickness) const
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles || !m_fontHandles->face)
+        return {};
+
+    // Set the character size
+    if (!setCurrentSize(characterSize))
+        return {};
+
+    // Rasterize the glyph
+    Glyph glyph = rasterizeGlyph(m_fontHandles->library,
+                                 m_fontHandles->face,
+                                 m_fontHandles->stroker,
+                                 codePoint,
+                                 bold,
+                                 outlineThickness,
+                                 page.texture.m_alphaOnly,
+                                 m_pixelBuffer);
+
+    // Turn the coverage into a distance field if the page holds distance field glyphs
+    if (page.spread > 0)
+        computeDistanceField(glyph, m_pixelBuffer, page.texture.m_alphaOnly, page.spread);
+
+    if ((glyph.textureRect.width > 0) && (glyph.textureRect.height > 0))
+    {
         // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, {width, height});
+        const IntRect rect = findGlyphRect(page, Vector2u(glyph.textureRect.getSize()));
+
+        // Write the pixels to the texture
+        if (page.texture.m_alphaOnly)
+            page.texture.updateAlpha(m_pixelBuffer.data(), Vector2u(rect.getSize()), Vector2u(rect.getPosition()));
+        else
+            page.texture.update(m_pixelBuffer.data(), Vector2u(rect.getSize()), Vector2u(rect.getPosition()));
 
         // Make sure the texture data is positioned in the center
         // of the allocated texture rectangle
-        glyph.textureRect.left += static_cast<int>(padding);
-        glyph.textureRect.top += static_cast<int>(padding);
-        glyph.textureRect.width -= static_cast<int>(2 * padding);
-        glyph.textureRect.height -= static_cast<int>(2 * padding);
+        const auto padding = static_cast<int>(glyphPadding + page.spread);
+        glyph.textureRect  = IntRect({rect.left + padding, rect.top + padding},
+                                    {rect.width - 2 * padding, rect.height - 2 * padding});
+    }
 
-        // Compute the glyph's bounding box
-        glyph.bounds.left   = static_cast<float>(bitmapGlyph->left);
-        glyph.bounds.top    = static_cast<float>(-bitmapGlyph->top);
-        glyph.bounds.width  = static_cast<float>(bitmap.width);
-        glyph.bounds.height = static_cast<float>(bitmap.rows);
+    return glyph;
+}
 
-        // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
 
-        std::uint8_t* current = m_pixelBuffer.data();
-        std::uint8_t* end     = current + width * height * 4;
+////////////////////////////////////////////////////////////
+std::size_t Font::addGlyph(Page& page, std::uint64_t key, const Glyph& glyph) const
+{
+    std::size_t slot = 0;
+    if (!page.freeSlots.empty())
+    {
+        slot = page.freeSlots.back();
+        page.freeSlots.pop_back();
+    }
+    else
+    {
+        slot = page.glyphs.size();
+        page.glyphs.emplace_back();
+    }
 
-        while (current != end)
-        {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 0;
-        }
+    GlyphSlot& glyphSlot = page.glyphs[slot];
+    glyphSlot.glyph      = glyph;
+    glyphSlot.key        = key;
+    glyphSlot.allocation = IntRect();
+    glyphSlot.lastUse    = ++page.useCounter;
+    glyphSlot.used       = true;
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+    // Remember the area allocated in the texture, so that it can be reclaimed later
+    if ((glyph.textureRect.width > 0) && (glyph.textureRect.height > 0))
+    {
+        const auto     padding = static_cast<int>(glyphPadding + page.spread);
+        const IntRect& rect    = glyph.textureRect;
+        glyphSlot.allocation   = IntRect({rect.left - padding, rect.top - padding},
+                                       {rect.width + 2 * padding, rect.height + 2 * padding});
+    }
+
+    page.glyphSlots.emplace(key, slot);
+
+    return slot;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
+{
+    unsigned int maximumSize = Texture::getMaximumSize();
+    if (m_maximumAtlasSize > 0)
+        maximumSize = std::min(maximumSize, m_maximumAtlasSize);
+
+    // Evict the least recently used glyphs until the new glyph fits
+    while (true)
+    {
+        if (const std::optional<IntRect> rect = allocateGlyphRect(page, size, maximumSize))
         {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < height - padding; ++y)
-            {
-                for (unsigned int x = padding; x < width - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = x + y * width;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
-                }
-                pixels += bitmap.pitch;
-            }
+            page.allocatedArea += static_cast<std::size_t>(rect->width) * static_cast<std::size_t>(rect->height);
+            return *rect;
         }
-        else
+
+        if (!evictGlyphs(page))
         {
-            // Pixels are 8 bits gray levels
-            for (unsigned int y = padding; y < height - padding; ++y)
-            {
-                for (unsigned int x = padding; x < width - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * width;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
-                }
-                pixels += bitmap.pitch;
-            }
+            // Oops, the glyph doesn't fit even in an empty texture...
+            err() << "Failed to add a new character to the font: the maximum texture size has been reached"
+                  << std::endl;
+            return {{0, 0}, {2, 2}};
         }
-
-        // Write the pixels to the texture
-        const unsigned int x = static_cast<unsigned int>(glyph.textureRect.left) - padding;
-        const unsigned int y = static_cast<unsigned int>(glyph.textureRect.top) - padding;
-        const unsigned int w = static_cast<unsigned int>(glyph.textureRect.width) + 2 * padding;
-        const unsigned int h = static_cast<unsigned int>(glyph.textureRect.height) + 2 * padding;
-        page.texture.update(m_pixelBuffer.data(), {w, h}, {x, y});
     }
-
-    // Delete the FT glyph
-    FT_Done_Glyph(glyphDesc);
-
-    // Done :)
-    return glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
+std::optional<IntRect> Font::allocateGlyphRect(Page& page, const Vector2u& size, unsigned int maximumSize) const
 {
+    // Find the smallest reclaimed span of a row that can hold the glyph
+    const auto findSpan = [&size](Row& row)
+    {
+        auto best = row.freeSpans.end();
+        for (auto it = row.freeSpans.begin(); it != row.freeSpans.end(); ++it)
+        {
+            if ((it->width >= size.x) && ((best == row.freeSpans.end()) || (it->width < best->width)))
+                best = it;
+        }
+        return best;
+    };
+
     // Find the line that fits well the glyph
     Row*  row       = nullptr;
     float bestRatio = 0;
@@ -650,8 +1374,8 @@ IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
         if ((ratio < 0.7f) || (ratio > 1.f))
             continue;
 
-        // Check if there's enough horizontal space left in the row
-        if (size.x > page.texture.getSize().x - it->width)
+        // Check if there's enough horizontal space left in the row, either at its end or in a reclaimed span
+        if ((size.x > page.texture.getSize().x - it->width) && (findSpan(*it) == it->freeSpans.end()))
             continue;
 
         // Make sure that this new row is the best found so far
@@ -671,14 +1395,16 @@ IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
         {
             // Not enough space: resize the texture if possible
             const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize()) && (textureSize.y * 2 <= Texture::getMaximumSize()))
+            if ((textureSize.x * 2 <= maximumSize) && (textureSize.y * 2 <= maximumSize))
             {
                 // Make the texture 2 times bigger
-                Texture newTexture;
-                if (!newTexture.create(textureSize * 2u))
+                Texture    newTexture;
+                const bool created = page.texture.m_alphaOnly ? newTexture.createAlpha(textureSize * 2u)
+                                                              : newTexture.create(textureSize * 2u);
+                if (!created)
                 {
                     err() << "Failed to create new page texture" << std::endl;
-                    return {{0, 0}, {2, 2}};
+                    return IntRect({0, 0}, {2, 2});
                 }
 
                 newTexture.setSmooth(m_isSmooth);
@@ -687,10 +1413,8 @@ IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
             }
             else
             {
-                // Oops, we've reached the maximum texture size...
-                err() << "Failed to add a new character to the font: the maximum texture size has been reached"
-                      << std::endl;
-                return {{0, 0}, {2, 2}};
+                // The texture can't grow anymore
+                return std::nullopt;
             }
         }
 
@@ -700,8 +1424,21 @@ IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
         row = &page.rows.back();
     }
 
+    // Prefer reclaimed space, so that the end of the row stays available for wide glyphs
+    if (const auto span = findSpan(*row); span != row->freeSpans.end())
+    {
+        const IntRect rect(Rect<unsigned int>({span->left, row->top}, size));
+
+        span->left += size.x;
+        span->width -= size.x;
+        if (span->width == 0)
+            row->freeSpans.erase(span);
+
+        return rect;
+    }
+
     // Find the glyph's rectangle on the selected row
-    IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
+    const IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
 
     // Update the row information
     row->width += size.x;
@@ -710,6 +1447,126 @@ IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Font::evictGlyphs(Page& page) const
+{
+    // Gather the glyphs that occupy some space in the texture
+    std::vector<std::size_t> candidates;
+    for (std::size_t i = 0; i < page.glyphs.size(); ++i)
+    {
+        if (page.glyphs[i].used && (page.glyphs[i].allocation.width > 0))
+            candidates.push_back(i);
+    }
+
+    if (candidates.empty())
+        return false;
+
+    // Evict the least recently used quarter of them at once, to amortize the cost of eviction
+    const std::size_t evictCount = std::max<std::size_t>(candidates.size() / 4, 1);
+    std::nth_element(candidates.begin(),
+                     candidates.begin() + static_cast<std::ptrdiff_t>(evictCount - 1),
+                     candidates.end(),
+                     [&page](std::size_t left, std::size_t right)
+                     { return page.glyphs[left].lastUse < page.glyphs[right].lastUse; });
+
+    for (std::size_t i = 0; i < evictCount; ++i)
+    {
+        GlyphSlot&    glyphSlot  = page.glyphs[candidates[i]];
+        const IntRect allocation = glyphSlot.allocation;
+
+        // Give the space back to its row, merging it with the neighboring free spans
+        for (Row& row : page.rows)
+        {
+            if (static_cast<int>(row.top) != allocation.top)
+                continue;
+
+            const Span freed{static_cast<unsigned int>(allocation.left), static_cast<unsigned int>(allocation.width)};
+            const auto position = std::lower_bound(row.freeSpans.begin(),
+                                                   row.freeSpans.end(),
+                                                   freed,
+                                                   [](const Span& left, const Span& right)
+                                                   { return left.left < right.left; });
+            auto       it       = row.freeSpans.insert(position, freed);
+
+            if ((std::next(it) != row.freeSpans.end()) && (it->left + it->width == std::next(it)->left))
+            {
+                it->width += std::next(it)->width;
+                row.freeSpans.erase(std::next(it));
+            }
+
+            if ((it != row.freeSpans.begin()) && (std::prev(it)->left + std::prev(it)->width == it->left))
+            {
+                std::prev(it)->width += it->width;
+                it = std::prev(row.freeSpans.erase(it));
+            }
+
+            // Space at the end of the row doesn't need to be tracked as a span
+            if (it->left + it->width == row.width)
+            {
+                row.width = it->left;
+                row.freeSpans.erase(it);
+            }
+
+            break;
+        }
+
+        page.allocatedArea -= static_cast<std::size_t>(allocation.width) * static_cast<std::size_t>(allocation.height);
+        page.glyphSlots.erase(glyphSlot.key);
+        page.freeSlots.push_back(candidates[i]);
+        ++page.evictionCount;
+
+        glyphSlot = GlyphSlot();
+    }
+
+    // Forget about the evicted glyphs in the direct lookup tables
+    for (GlyphLookupTable& table : page.lookupTables)
+    {
+        for (std::vector<std::uint32_t>& block : table.blocks)
+        {
+            for (std::uint32_t& entry : block)
+            {
+                if ((entry != 0) && !page.glyphs[entry - 1].used)
+                    entry = 0;
+            }
+        }
+    }
+
+    // Remove the empty rows at the bottom of the texture, so that their height can be reused
+    while (!page.rows.empty() && (page.rows.back().width == 0))
+    {
+        page.nextRow = page.rows.back().top;
+        page.rows.pop_back();
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader* Font::getDistanceFieldShader() const
+{
+    if (!m_shaderLoadAttempted)
+    {
+        m_shaderLoadAttempted = true;
+
+        if (Shader::isAvailable())
+        {
+            if (auto shader = Shader::loadFromMemory(distanceFieldVertexShader, distanceFieldFragmentShader))
+            {
+                shader->setUniform("texture", Shader::CurrentTexture);
+                m_distanceFieldShader = std::make_shared<Shader>(std::move(*shader));
+            }
+            else
+            {
+                err() << "Failed to compile the distance field shader, text will be drawn from bitmaps" << std::endl;
+            }
+        }
+    }
+
+    return m_distanceFieldShader.get();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Font::setCurrentSize(unsigned int characterSize) const
 {
@@ -752,7 +1609,7 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 
 
 ////////////////////////////////////////////////////////////
-Font::Page::Page(bool smooth)
+Font::Page::Page(bool smooth, bool alphaOnly, unsigned int pageSpread) : spread(pageSpread)
 {
     // Make sure that the texture is initialized by default
     Image image({128, 128}, Color::Transparent);
@@ -763,7 +1620,12 @@ Font::Page::Page(bool smooth)
             image.setPixel({x, y}, Color::White);
 
     // Create the texture
-    if (!texture.loadFromImage(image))
+    const bool created = alphaOnly ? texture.createAlpha(image.getSize()) : texture.create(image.getSize());
+    if (created)
+    {
+        texture.update(image);
+    }
+    else
     {
         err() << "Failed to load font page texture" << std::endl;
     }
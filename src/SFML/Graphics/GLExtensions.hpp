@@ -53,16 +53,17 @@
 
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object true
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
+#define GLEXT_vertex_buffer_object    true
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -149,6 +150,14 @@
 #define GLEXT_GL_MIN       GL_MIN_EXT
 #define GLEXT_GL_MAX       GL_MAX_EXT
 
+// Core since 3.0 - Texture swizzle
+#define GLEXT_texture_swizzle         false
+#define GLEXT_GL_TEXTURE_SWIZZLE_RGBA 0
+
+// Core since 3.0 - Uniform buffer objects
+#define GLEXT_uniform_buffer_object false
+#define GLEXT_GL_UNIFORM_BUFFER     0
+
 #else
 
 // SFML requires at a bare minimum OpenGL 1.1 capability
@@ -194,6 +203,7 @@
 // Core since 1.5 - ARB_vertex_buffer_object
 #define GLEXT_vertex_buffer_object                SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                     GL_ARRAY_BUFFER_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER             GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                     GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_READ_ONLY                        GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                      GL_STATIC_DRAW_ARB
@@ -204,6 +214,7 @@
 #define GLEXT_glBufferSubData                     glBufferSubDataARB
 #define GLEXT_glDeleteBuffers                     glDeleteBuffersARB
 #define GLEXT_glGenBuffers                        glGenBuffersARB
+#define GLEXT_glGetBufferSubData                  glGetBufferSubDataARB
 #define GLEXT_glMapBuffer                         glMapBufferARB
 #define GLEXT_glUnmapBuffer                       glUnmapBufferARB
 
@@ -246,6 +257,12 @@
 
 // Core since 2.0 - ARB_vertex_shader
 #define GLEXT_vertex_shader                       SF_GLAD_GL_ARB_vertex_shader
+#define GLEXT_glGetAttribLocation                 glGetAttribLocationARB
+#define GLEXT_glVertexAttribPointer               glVertexAttribPointerARB
+#define GLEXT_glEnableVertexAttribArray           glEnableVertexAttribArrayARB
+#define GLEXT_glDisableVertexAttribArray          glDisableVertexAttribArrayARB
+#define GLEXT_glVertexAttrib3f                    glVertexAttrib3fARB
+#define GLEXT_glVertexAttrib4f                    glVertexAttrib4fARB
 #define GLEXT_GL_VERTEX_SHADER                    GL_VERTEX_SHADER_ARB
 #define GLEXT_GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS_ARB
 
@@ -264,6 +281,12 @@
 #define GLEXT_texture_sRGB                        SF_GLAD_GL_EXT_texture_sRGB
 #define GLEXT_GL_SRGB8_ALPHA8                     GL_SRGB8_ALPHA8_EXT
 
+// Core since 2.1 - ARB_pixel_buffer_object
+#define GLEXT_pixel_buffer_object                 SF_GLAD_GL_VERSION_2_1
+#define GLEXT_GL_PIXEL_PACK_BUFFER                GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER              GL_PIXEL_UNPACK_BUFFER
+#define GLEXT_GL_STREAM_READ                      GL_STREAM_READ_ARB
+
 // Core since 3.0 - EXT_framebuffer_object
 #define GLEXT_framebuffer_object                  SF_GLAD_GL_EXT_framebuffer_object
 #define GLEXT_glBindRenderbuffer                  glBindRenderbufferEXT
@@ -304,16 +327,64 @@
 #define GLEXT_glRenderbufferStorageMultisample    glRenderbufferStorageMultisampleEXT
 #define GLEXT_GL_MAX_SAMPLES                      GL_MAX_SAMPLES_EXT
 
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range                    (SF_GLAD_GL_ARB_map_buffer_range || SF_GLAD_GL_VERSION_3_0)
+#define GLEXT_glMapBufferRange                    glMapBufferRange
+#define GLEXT_GL_MAP_WRITE_BIT                    GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT         GL_MAP_INVALIDATE_RANGE_BIT
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT           GL_MAP_UNSYNCHRONIZED_BIT
+
 // Core since 3.1 - ARB_copy_buffer
 #define GLEXT_copy_buffer                         SF_GLAD_GL_ARB_copy_buffer
 #define GLEXT_GL_COPY_READ_BUFFER                 GL_COPY_READ_BUFFER
 #define GLEXT_GL_COPY_WRITE_BUFFER                GL_COPY_WRITE_BUFFER
 #define GLEXT_glCopyBufferSubData                 glCopyBufferSubData
 
+// Core since 3.1 - ARB_uniform_buffer_object
+#define GLEXT_uniform_buffer_object               (SF_GLAD_GL_ARB_uniform_buffer_object || SF_GLAD_GL_VERSION_3_1)
+#define GLEXT_glGetUniformBlockIndex              glGetUniformBlockIndex
+#define GLEXT_glUniformBlockBinding               glUniformBlockBinding
+#define GLEXT_glBindBufferBase                    glBindBufferBase
+#define GLEXT_GL_UNIFORM_BUFFER                   GL_UNIFORM_BUFFER
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS      GL_MAX_UNIFORM_BUFFER_BINDINGS
+#define GLEXT_GL_INVALID_INDEX                    GL_INVALID_INDEX
+
 // Core since 3.2 - ARB_geometry_shader4
 #define GLEXT_geometry_shader4                    SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER                  GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                                (SF_GLAD_GL_ARB_sync || SF_GLAD_GL_VERSION_3_2)
+#define GLEXT_glFenceSync                         glFenceSync
+#define GLEXT_glClientWaitSync                    glClientWaitSync
+#define GLEXT_glDeleteSync                        glDeleteSync
+#define GLEXT_GLsync                              GLsync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE       GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT          GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_ALREADY_SIGNALED                 GL_ALREADY_SIGNALED
+#define GLEXT_GL_CONDITION_SATISFIED              GL_CONDITION_SATISFIED
+#define GLEXT_GL_TIMEOUT_EXPIRED                  GL_TIMEOUT_EXPIRED
+
+// Core since 3.3 - ARB_texture_swizzle
+#define GLEXT_texture_swizzle                     SF_GLAD_GL_VERSION_3_3
+#define GLEXT_GL_TEXTURE_SWIZZLE_RGBA             GL_TEXTURE_SWIZZLE_RGBA
+
+// Core since 3.3 - ARB_instanced_arrays
+#define GLEXT_instanced_arrays                    SF_GLAD_GL_VERSION_3_3
+#define GLEXT_glVertexAttribDivisor               glVertexAttribDivisor
+#define GLEXT_glDrawArraysInstanced               glDrawArraysInstanced
+
+// Core since 4.1 - ARB_get_program_binary
+#define GLEXT_get_program_binary                  (SF_GLAD_GL_ARB_get_program_binary || SF_GLAD_GL_VERSION_4_1)
+#define GLEXT_glGetProgramiv                      glGetProgramiv
+#define GLEXT_glGetProgramBinary                  glGetProgramBinary
+#define GLEXT_glProgramBinary                     glProgramBinary
+#define GLEXT_glProgramParameteri                 glProgramParameteri
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT  GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH            GL_PROGRAM_BINARY_LENGTH
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS       GL_NUM_PROGRAM_BINARY_FORMATS
+#define GLEXT_GL_PROGRAM_BINARY_FORMATS           GL_PROGRAM_BINARY_FORMATS
+
 #endif
 
 // OpenGL Versions
@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PixelOperations.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
@@ -163,13 +164,34 @@ Image::Image(Vector2u size, std::vector<std::uint8_t>&& pixels) : m_size(size),
 
 ////////////////////////////////////////////////////////////
 std::optional<Image> Image::loadFromFile(const std::filesystem::path& filename)
+{
+    return loadFromFile(filename, err());
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> Image::loadFromMemory(const void* data, std::size_t size)
+{
+    return loadFromMemory(data, size, err());
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> Image::loadFromStream(InputStream& stream)
+{
+    return loadFromStream(stream, err());
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> Image::loadFromFile(const std::filesystem::path& filename, std::ostream& errorStream)
 {
 #ifdef SFML_SYSTEM_ANDROID
 
     if (priv::getActivityStatesPtr() != nullptr)
     {
         priv::ResourceStream stream(filename);
-        return loadFromStream(stream);
+        return loadFromStream(stream, errorStream);
     }
 
 #endif
@@ -187,8 +209,8 @@ std::optional<Image> Image::loadFromFile(const std::filesystem::path& filename)
     else
     {
         // Error, failed to load the image
-        err() << "Failed to load image\n"
-              << formatDebugPathInfo(filename) << "\nReason: " << stbi_failure_reason() << std::endl;
+        errorStream << "Failed to load image\n"
+                    << formatDebugPathInfo(filename) << "\nReason: " << stbi_failure_reason() << std::endl;
 
         return std::nullopt;
     }
@@ -196,7 +218,7 @@ std::optional<Image> Image::loadFromFile(const std::filesystem::path& filename)
 
 
 ////////////////////////////////////////////////////////////
-std::optional<Image> Image::loadFromMemory(const void* data, std::size_t size)
+std::optional<Image> Image::loadFromMemory(const void* data, std::size_t size, std::ostream& errorStream)
 {
     // Check input parameters
     if (data && size)
@@ -216,26 +238,26 @@ std::optional<Image> Image::loadFromMemory(const void* data, std::size_t size)
         else
         {
             // Error, failed to load the image
-            err() << "Failed to load image from memory. Reason: " << stbi_failure_reason() << std::endl;
+            errorStream << "Failed to load image from memory. Reason: " << stbi_failure_reason() << std::endl;
 
             return std::nullopt;
         }
     }
     else
     {
-        err() << "Failed to load image from memory, no data provided" << std::endl;
+        errorStream << "Failed to load image from memory, no data provided" << std::endl;
         return std::nullopt;
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-std::optional<Image> Image::loadFromStream(InputStream& stream)
+std::optional<Image> Image::loadFromStream(InputStream& stream, std::ostream& errorStream)
 {
     // Make sure that the stream's reading position is at the beginning
     if (stream.seek(0) == -1)
     {
-        err() << "Failed to seek image stream" << std::endl;
+        errorStream << "Failed to seek image stream" << std::endl;
         return std::nullopt;
     }
 
@@ -258,7 +280,7 @@ std::optional<Image> Image::loadFromStream(InputStream& stream)
     else
     {
         // Error, failed to load the image
-        err() << "Failed to load image from stream. Reason: " << stbi_failure_reason() << std::endl;
+        errorStream << "Failed to load image from stream. Reason: " << stbi_failure_reason() << std::endl;
         return std::nullopt;
     }
 }
@@ -368,14 +390,7 @@ void Image::createMaskFromColor(const Color& color, std::uint8_t alpha)
     if (!m_pixels.empty())
     {
         // Replace the alpha of the pixels that match the transparent color
-        std::uint8_t* ptr = m_pixels.data();
-        std::uint8_t* end = ptr + m_pixels.size();
-        while (ptr < end)
-        {
-            if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
-                ptr[3] = alpha;
-            ptr += 4;
-        }
+        priv::maskPixels(m_pixels.data(), m_pixels.size() / 4, color, alpha);
     }
 }
 
@@ -425,29 +440,10 @@ void Image::createMaskFromColor(const Color& color, std::uint8_t alpha)
     // Copy the pixels
     if (applyAlpha)
     {
-        // Interpolation using alpha values, pixel by pixel (slower)
+        // Interpolation using alpha values, row by row (slower)
         for (unsigned int i = 0; i < dstSize.y; ++i)
         {
-            for (unsigned int j = 0; j < dstSize.x; ++j)
-            {
-                // Get a direct pointer to the components of the current pixel
-                const std::uint8_t* src = srcPixels + j * 4;
-                std::uint8_t*       dst = dstPixels + j * 4;
-
-                // Interpolate RGBA components using the alpha values of the destination and source pixels
-                const std::uint8_t srcAlpha = src[3];
-                const std::uint8_t dstAlpha = dst[3];
-                const auto outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
-
-                dst[3] = outAlpha;
-
-                if (outAlpha)
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
-                else
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = src[k];
-            }
+            priv::blendPixels(dstPixels, srcPixels, dstSize.x);
 
             srcPixels += srcStride;
             dstPixels += dstStride;
@@ -518,19 +514,7 @@ void Image::flipHorizontally()
         const std::size_t rowSize = m_size.x * 4;
 
         for (std::size_t y = 0; y < m_size.y; ++y)
-        {
-            auto left = m_pixels.begin() + static_cast<std::vector<std::uint8_t>::iterator::difference_type>(y * rowSize);
-            auto right = m_pixels.begin() +
-                         static_cast<std::vector<std::uint8_t>::iterator::difference_type>((y + 1) * rowSize - 4);
-
-            for (std::size_t x = 0; x < m_size.x / 2; ++x)
-            {
-                std::swap_ranges(left, left + 4, right);
-
-                left += 4;
-                right -= 4;
-            }
-        }
+            priv::reversePixels(m_pixels.data() + y * rowSize, m_size.x);
     }
 }
 
@@ -540,14 +524,14 @@ void Image::flipVertically()
 {
     if (!m_pixels.empty())
     {
-        const auto rowSize = static_cast<std::vector<std::uint8_t>::iterator::difference_type>(m_size.x * 4);
+        const std::size_t rowSize = m_size.x * 4;
 
-        auto top    = m_pixels.begin();
-        auto bottom = m_pixels.end() - rowSize;
+        std::uint8_t* top    = m_pixels.data();
+        std::uint8_t* bottom = m_pixels.data() + m_pixels.size() - rowSize;
 
         for (std::size_t y = 0; y < m_size.y / 2; ++y)
         {
-            std::swap_ranges(top, top + rowSize, bottom);
+            priv::swapPixels(top, bottom, rowSize);
 
             top += rowSize;
             bottom -= rowSize;
@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageLoader.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+
+namespace
+{
+// sf::err() is a single unsynchronized stream: the worker threads collect their error
+// messages separately while decoding, and write them to sf::err() one at a time
+void reportErrors(const std::ostringstream& errorStream)
+{
+    static std::mutex errorMutex;
+
+    if (const std::string errors = errorStream.str(); !errors.empty())
+    {
+        const std::lock_guard lock(errorMutex);
+        sf::err() << errors << std::flush;
+    }
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ImageLoader::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the tasks of the queue until the loader is destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    void run()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock, [this] { return stopping || !tasks.empty(); });
+
+                // Pending tasks are completed before stopping, so that no future is left unsatisfied
+                if (tasks.empty())
+                    return;
+
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    std::vector<std::thread>          threads;    //!< Worker threads
+    std::deque<std::function<void()>> tasks;      //!< Loading tasks waiting for a worker thread
+    std::mutex                        mutex;      //!< Mutex protecting the queue
+    std::condition_variable           condition;  //!< Condition signaled when a task is queued or the loader stops
+    bool                              stopping{}; //!< Is the loader being destroyed?
+};
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::ImageLoader(unsigned int threadCount) : m_impl(std::make_unique<Impl>())
+{
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    m_impl->threads.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        m_impl->threads.emplace_back(&Impl::run, m_impl.get());
+}
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::~ImageLoader()
+{
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        m_impl->stopping = true;
+    }
+
+    m_impl->condition.notify_all();
+
+    for (std::thread& thread : m_impl->threads)
+        thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<Image>> ImageLoader::loadFromFile(const std::filesystem::path& filename)
+{
+    return enqueue(
+        [filename]
+        {
+            std::ostringstream errorStream;
+            auto               image = Image::loadFromFile(filename, errorStream);
+            reportErrors(errorStream);
+            return image;
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::future<std::optional<Image>>> ImageLoader::loadFromFiles(
+    const std::vector<std::filesystem::path>& filenames)
+{
+    std::vector<std::future<std::optional<Image>>> futures;
+    futures.reserve(filenames.size());
+
+    for (const std::filesystem::path& filename : filenames)
+        futures.push_back(loadFromFile(filename));
+
+    return futures;
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<Image>> ImageLoader::loadFromMemory(const void* data, std::size_t size)
+{
+    return enqueue(
+        [data, size]
+        {
+            std::ostringstream errorStream;
+            auto               image = Image::loadFromMemory(data, size, errorStream);
+            reportErrors(errorStream);
+            return image;
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ImageLoader::getThreadCount() const
+{
+    return static_cast<unsigned int>(m_impl->threads.size());
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<Image>> ImageLoader::enqueue(std::function<std::optional<Image>()> load)
+{
+    // std::function requires copyable targets, so the move-only task is shared
+    auto task   = std::make_shared<std::packaged_task<std::optional<Image>()>>(std::move(load));
+    auto future = task->get_future();
+
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        m_impl->tasks.emplace_back([task] { (*task)(); });
+    }
+
+    m_impl->condition.notify_one();
+
+    return future;
+}
+
+} // namespace sf
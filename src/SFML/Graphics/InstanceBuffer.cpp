@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+InstanceBuffer::InstanceBuffer(const InstanceBuffer& copy) :
+GlResource(copy),
+m_instances(copy.m_instances),
+m_needUpload(true)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer::~InstanceBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer& InstanceBuffer::operator=(const InstanceBuffer& right)
+{
+    InstanceBuffer temp(right);
+
+    swap(temp);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstanceBuffer::append(const Transform& transform, const Color& color)
+{
+    m_instances.emplace_back();
+    setInstance(m_instances.size() - 1, transform, color);
+}
+
+
+////////////////////////////////////////////////////////////
+void InstanceBuffer::setInstance(std::size_t index, const Transform& transform, const Color& color)
+{
+    assert(index < m_instances.size() && "InstanceBuffer::setInstance Index is out of range");
+
+    // Keep the 2D affine part of the matrix, which is stored in column-major order
+    const float* matrix = transform.getMatrix();
+
+    Instance& instance = m_instances[index];
+    instance.row0      = {matrix[0], matrix[4], matrix[12]};
+    instance.row1      = {matrix[1], matrix[5], matrix[13]};
+    instance.color     = color;
+
+    m_needUpload = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstanceBuffer::clear()
+{
+    m_instances.clear();
+    m_needUpload = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t InstanceBuffer::getInstanceCount() const
+{
+    return m_instances.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Transform InstanceBuffer::getTransform(std::size_t index) const
+{
+    assert(index < m_instances.size() && "InstanceBuffer::getTransform Index is out of range");
+
+    const Instance& instance = m_instances[index];
+
+    // clang-format off
+    return {instance.row0[0], instance.row0[1], instance.row0[2],
+            instance.row1[0], instance.row1[1], instance.row1[2],
+            0.f,              0.f,              1.f};
+    // clang-format on
+}
+
+
+////////////////////////////////////////////////////////////
+Color InstanceBuffer::getColor(std::size_t index) const
+{
+    assert(index < m_instances.size() && "InstanceBuffer::getColor Index is out of range");
+
+    return m_instances[index].color;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstanceBuffer::swap(InstanceBuffer& right) noexcept
+{
+    std::swap(m_instances, right.m_instances);
+    std::swap(m_buffer, right.m_buffer);
+    std::swap(m_bufferSize, right.m_bufferSize);
+    std::swap(m_needUpload, right.m_needUpload);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int InstanceBuffer::upload() const
+{
+    if (!m_needUpload || m_instances.empty())
+        return m_buffer;
+
+    if (!VertexBuffer::isAvailable())
+        return 0;
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create instance buffer, generation failed" << std::endl;
+        return 0;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    // Resize or orphan the buffer, the instances are typically updated every frame
+    m_bufferSize = m_instances.size();
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(sizeof(Instance) * m_bufferSize),
+                               m_instances.data(),
+                               GLEXT_GL_STREAM_DRAW));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    m_needUpload = false;
+
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void swap(InstanceBuffer& left, InstanceBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+} // namespace sf
@@ -0,0 +1,350 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PixelOperations.hpp>
+
+#include <algorithm>
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_PIXEL_OPERATIONS_SSE2
+#include <emmintrin.h>
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#define SFML_PIXEL_OPERATIONS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// Blend a source pixel over a destination pixel
+void blendPixel(std::uint8_t* dst, const std::uint8_t* src)
+{
+    // Interpolate RGBA components using the alpha values of the destination and source pixels
+    const std::uint8_t srcAlpha = src[3];
+    const std::uint8_t dstAlpha = dst[3];
+    const auto         outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+
+    dst[3] = outAlpha;
+
+    if (outAlpha)
+        for (int k = 0; k < 3; k++)
+            dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
+    else
+        for (int k = 0; k < 3; k++)
+            dst[k] = src[k];
+}
+
+#if defined(SFML_PIXEL_OPERATIONS_SSE2) || defined(SFML_PIXEL_OPERATIONS_NEON)
+
+// Pack the components of a pixel into a 32-bit value, in memory order
+std::uint32_t packPixel(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
+{
+    const std::uint8_t bytes[] = {r, g, b, a};
+    std::uint32_t      pixel   = 0;
+    std::memcpy(&pixel, bytes, sizeof(pixel));
+    return pixel;
+}
+
+#endif
+
+#if defined(SFML_PIXEL_OPERATIONS_SSE2)
+
+// Select the bits of a where mask is set, and the bits of b elsewhere
+__m128i selectBits(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Blend a source pixel over a destination pixel, with one 32-bit component per lane
+// The integer divisions are computed in single precision: the quotients of integers
+// below 2^16 by divisors up to 255 are never rounded up to the next integer
+__m128i blendPixel(__m128i src, __m128i dst)
+{
+    const __m128 one   = _mm_set1_ps(1.f);
+    const __m128 c255  = _mm_set1_ps(255.f);
+    const __m128 color = _mm_cvtepi32_ps(src);
+    const __m128 under = _mm_cvtepi32_ps(dst);
+
+    const __m128 srcAlpha = _mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128 dstAlpha = _mm_shuffle_ps(under, under, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128 product  = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_div_ps(_mm_mul_ps(srcAlpha, dstAlpha), c255)));
+    const __m128 outAlpha = _mm_sub_ps(_mm_add_ps(srcAlpha, dstAlpha), product);
+
+    const __m128 numerator = _mm_add_ps(_mm_mul_ps(color, srcAlpha), _mm_mul_ps(under, _mm_sub_ps(outAlpha, srcAlpha)));
+    const __m128i result   = _mm_cvttps_epi32(_mm_div_ps(numerator, _mm_max_ps(outAlpha, one)));
+
+    // Keep the source color where the resulting alpha is 0, and put the resulting alpha in the last lane
+    const __m128i transparent = _mm_castps_si128(_mm_cmpeq_ps(outAlpha, _mm_setzero_ps()));
+    const __m128i alphaLane   = _mm_set_epi32(-1, 0, 0, 0);
+    return selectBits(alphaLane, _mm_cvttps_epi32(outAlpha), selectBits(transparent, src, result));
+}
+
+#elif defined(SFML_PIXEL_OPERATIONS_NEON)
+
+// Blend a source pixel over a destination pixel, with one 32-bit component per lane
+// The integer divisions are computed in single precision: the quotients of integers
+// below 2^16 by divisors up to 255 are never rounded up to the next integer
+uint32x4_t blendPixel(uint32x4_t src, uint32x4_t dst)
+{
+    const float32x4_t zero  = vdupq_n_f32(0.f);
+    const float32x4_t one   = vdupq_n_f32(1.f);
+    const float32x4_t c255  = vdupq_n_f32(255.f);
+    const float32x4_t color = vcvtq_f32_u32(src);
+    const float32x4_t under = vcvtq_f32_u32(dst);
+
+    const float32x4_t srcAlpha = vdupq_laneq_f32(color, 3);
+    const float32x4_t dstAlpha = vdupq_laneq_f32(under, 3);
+    const float32x4_t product  = vcvtq_f32_u32(vcvtq_u32_f32(vdivq_f32(vmulq_f32(srcAlpha, dstAlpha), c255)));
+    const float32x4_t outAlpha = vsubq_f32(vaddq_f32(srcAlpha, dstAlpha), product);
+
+    const float32x4_t weight    = vsubq_f32(outAlpha, srcAlpha);
+    const float32x4_t numerator = vaddq_f32(vmulq_f32(color, srcAlpha), vmulq_f32(under, weight));
+    const uint32x4_t  result    = vcvtq_u32_f32(vdivq_f32(numerator, vmaxq_f32(outAlpha, one)));
+
+    // Keep the source color where the resulting alpha is 0, and put the resulting alpha in the last lane
+    const uint32x4_t transparent = vceqq_f32(outAlpha, zero);
+    const uint32x4_t alphaLane   = vsetq_lane_u32(0xFFFFFFFF, vdupq_n_u32(0), 3);
+    return vbslq_u32(alphaLane, vcvtq_u32_f32(outAlpha), vbslq_u32(transparent, src, result));
+}
+
+#endif
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void maskPixels(std::uint8_t* pixels, std::size_t pixelCount, const Color& color, std::uint8_t alpha)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_PIXEL_OPERATIONS_SSE2)
+
+    const __m128i keys       = _mm_set1_epi32(static_cast<int>(packPixel(color.r, color.g, color.b, color.a)));
+    const __m128i alphaMasks = _mm_set1_epi32(static_cast<int>(packPixel(0, 0, 0, 255)));
+    const __m128i newAlphas  = _mm_set1_epi32(static_cast<int>(packPixel(0, 0, 0, alpha)));
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto*         block = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i value = _mm_loadu_si128(block);
+        const __m128i match = _mm_and_si128(_mm_cmpeq_epi32(value, keys), alphaMasks);
+        _mm_storeu_si128(block, selectBits(match, newAlphas, value));
+    }
+
+#elif defined(SFML_PIXEL_OPERATIONS_NEON)
+
+    const uint32x4_t keys       = vdupq_n_u32(packPixel(color.r, color.g, color.b, color.a));
+    const uint32x4_t alphaMasks = vdupq_n_u32(packPixel(0, 0, 0, 255));
+    const uint32x4_t newAlphas  = vdupq_n_u32(packPixel(0, 0, 0, alpha));
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        const uint32x4_t value = vreinterpretq_u32_u8(vld1q_u8(pixels + i * 4));
+        const uint32x4_t match = vandq_u32(vceqq_u32(value, keys), alphaMasks);
+        vst1q_u8(pixels + i * 4, vreinterpretq_u8_u32(vbslq_u32(match, newAlphas, value)));
+    }
+
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        std::uint8_t* pixel = pixels + i * 4;
+        if ((pixel[0] == color.r) && (pixel[1] == color.g) && (pixel[2] == color.b) && (pixel[3] == color.a))
+            pixel[3] = alpha;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void blendPixels(std::uint8_t* destination, const std::uint8_t* source, std::size_t pixelCount)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_PIXEL_OPERATIONS_SSE2)
+
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto*         block = reinterpret_cast<__m128i*>(destination + i * 4);
+        const __m128i src   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+        const __m128i dst   = _mm_loadu_si128(block);
+
+        // Widen the components of the 4 pixels to 32 bits
+        const __m128i srcLow  = _mm_unpacklo_epi8(src, zero);
+        const __m128i srcHigh = _mm_unpackhi_epi8(src, zero);
+        const __m128i dstLow  = _mm_unpacklo_epi8(dst, zero);
+        const __m128i dstHigh = _mm_unpackhi_epi8(dst, zero);
+
+        const __m128i pixel0 = blendPixel(_mm_unpacklo_epi16(srcLow, zero), _mm_unpacklo_epi16(dstLow, zero));
+        const __m128i pixel1 = blendPixel(_mm_unpackhi_epi16(srcLow, zero), _mm_unpackhi_epi16(dstLow, zero));
+        const __m128i pixel2 = blendPixel(_mm_unpacklo_epi16(srcHigh, zero), _mm_unpacklo_epi16(dstHigh, zero));
+        const __m128i pixel3 = blendPixel(_mm_unpackhi_epi16(srcHigh, zero), _mm_unpackhi_epi16(dstHigh, zero));
+
+        _mm_storeu_si128(block, _mm_packus_epi16(_mm_packs_epi32(pixel0, pixel1), _mm_packs_epi32(pixel2, pixel3)));
+    }
+
+#elif defined(SFML_PIXEL_OPERATIONS_NEON)
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        const uint8x16_t src = vld1q_u8(source + i * 4);
+        const uint8x16_t dst = vld1q_u8(destination + i * 4);
+
+        // Widen the components of the 4 pixels to 32 bits
+        const uint16x8_t srcLow  = vmovl_u8(vget_low_u8(src));
+        const uint16x8_t srcHigh = vmovl_u8(vget_high_u8(src));
+        const uint16x8_t dstLow  = vmovl_u8(vget_low_u8(dst));
+        const uint16x8_t dstHigh = vmovl_u8(vget_high_u8(dst));
+
+        const uint32x4_t pixel0 = blendPixel(vmovl_u16(vget_low_u16(srcLow)), vmovl_u16(vget_low_u16(dstLow)));
+        const uint32x4_t pixel1 = blendPixel(vmovl_u16(vget_high_u16(srcLow)), vmovl_u16(vget_high_u16(dstLow)));
+        const uint32x4_t pixel2 = blendPixel(vmovl_u16(vget_low_u16(srcHigh)), vmovl_u16(vget_low_u16(dstHigh)));
+        const uint32x4_t pixel3 = blendPixel(vmovl_u16(vget_high_u16(srcHigh)), vmovl_u16(vget_high_u16(dstHigh)));
+
+        const uint16x8_t low  = vcombine_u16(vmovn_u32(pixel0), vmovn_u32(pixel1));
+        const uint16x8_t high = vcombine_u16(vmovn_u32(pixel2), vmovn_u32(pixel3));
+        vst1q_u8(destination + i * 4, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+
+#endif
+
+    for (; i < pixelCount; ++i)
+        blendPixel(destination + i * 4, source + i * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void reversePixels(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    std::uint8_t* left  = pixels;
+    std::uint8_t* right = pixels + pixelCount * 4;
+
+#if defined(SFML_PIXEL_OPERATIONS_SSE2)
+
+    // Swap blocks of 4 pixels from both ends, reversing the order of the pixels within the blocks
+    while (right - left >= 32)
+    {
+        right -= 16;
+        const __m128i leftBlock  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left));
+        const __m128i rightBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(left), _mm_shuffle_epi32(rightBlock, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(right), _mm_shuffle_epi32(leftBlock, _MM_SHUFFLE(0, 1, 2, 3)));
+        left += 16;
+    }
+
+#elif defined(SFML_PIXEL_OPERATIONS_NEON)
+
+    // Swap blocks of 4 pixels from both ends, reversing the order of the pixels within the blocks
+    while (right - left >= 32)
+    {
+        right -= 16;
+        const uint32x4_t leftBlock  = vreinterpretq_u32_u8(vld1q_u8(left));
+        const uint32x4_t rightBlock = vreinterpretq_u32_u8(vld1q_u8(right));
+        const uint32x4_t leftSwap   = vrev64q_u32(rightBlock);
+        const uint32x4_t rightSwap  = vrev64q_u32(leftBlock);
+        vst1q_u8(left, vreinterpretq_u8_u32(vextq_u32(leftSwap, leftSwap, 2)));
+        vst1q_u8(right, vreinterpretq_u8_u32(vextq_u32(rightSwap, rightSwap, 2)));
+        left += 16;
+    }
+
+#endif
+
+    while (right - left >= 8)
+    {
+        right -= 4;
+        std::swap_ranges(left, left + 4, right);
+        left += 4;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void swapPixels(std::uint8_t* first, std::uint8_t* second, std::size_t byteCount)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_PIXEL_OPERATIONS_SSE2)
+
+    for (; i + 16 <= byteCount; i += 16)
+    {
+        auto*         firstBlock  = reinterpret_cast<__m128i*>(first + i);
+        auto*         secondBlock = reinterpret_cast<__m128i*>(second + i);
+        const __m128i value       = _mm_loadu_si128(firstBlock);
+        _mm_storeu_si128(firstBlock, _mm_loadu_si128(secondBlock));
+        _mm_storeu_si128(secondBlock, value);
+    }
+
+#elif defined(SFML_PIXEL_OPERATIONS_NEON)
+
+    for (; i + 16 <= byteCount; i += 16)
+    {
+        const uint8x16_t value = vld1q_u8(first + i);
+        vst1q_u8(first + i, vld1q_u8(second + i));
+        vst1q_u8(second + i, value);
+    }
+
+#endif
+
+    std::swap_ranges(first + i, first + byteCount, second + i);
+}
+
+
+////////////////////////////////////////////////////////////
+void whitenPixels(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_PIXEL_OPERATIONS_SSE2)
+
+    const __m128i white = _mm_set1_epi32(static_cast<int>(packPixel(255, 255, 255, 0)));
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto* block = reinterpret_cast<__m128i*>(pixels + i * 4);
+        _mm_storeu_si128(block, _mm_or_si128(_mm_loadu_si128(block), white));
+    }
+
+#elif defined(SFML_PIXEL_OPERATIONS_NEON)
+
+    const uint32x4_t white = vdupq_n_u32(packPixel(255, 255, 255, 0));
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        const uint32x4_t value = vreinterpretq_u32_u8(vld1q_u8(pixels + i * 4));
+        vst1q_u8(pixels + i * 4, vreinterpretq_u8_u32(vorrq_u32(value, white)));
+    }
+
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        pixels[i * 4]     = 255;
+        pixels[i * 4 + 1] = 255;
+        pixels[i * 4 + 2] = 255;
+    }
+}
+
+} // namespace sf::priv
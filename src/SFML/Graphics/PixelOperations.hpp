@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+// Pixel processing kernels shared by sf::Image and sf::Texture, operating on tightly
+// packed 8-bit RGBA pixels. They use SSE2 on x86 and NEON on ARM64, which are part of
+// the baseline of these architectures, and portable code elsewhere. All implementations
+// produce exactly the same results.
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Replace the alpha of the pixels matching a color
+///
+/// \param pixels     Pixels to process
+/// \param pixelCount Number of pixels
+/// \param color      Color of the pixels to modify
+/// \param alpha      Alpha value to assign to the matching pixels
+///
+////////////////////////////////////////////////////////////
+void maskPixels(std::uint8_t* pixels, std::size_t pixelCount, const Color& color, std::uint8_t alpha);
+
+////////////////////////////////////////////////////////////
+/// \brief Blend source pixels over destination pixels
+///
+/// The resulting alpha is `srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255`,
+/// and the color components are interpolated with the alpha
+/// values of the source and destination pixels, using
+/// integer divisions.
+///
+/// \param destination Pixels to blend onto
+/// \param source      Pixels to blend
+/// \param pixelCount  Number of pixels
+///
+////////////////////////////////////////////////////////////
+void blendPixels(std::uint8_t* destination, const std::uint8_t* source, std::size_t pixelCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Reverse the order of a row of pixels
+///
+/// \param pixels     Pixels to reverse
+/// \param pixelCount Number of pixels
+///
+////////////////////////////////////////////////////////////
+void reversePixels(std::uint8_t* pixels, std::size_t pixelCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Swap two non-overlapping ranges of pixels
+///
+/// \param first     First range of pixels
+/// \param second    Second range of pixels
+/// \param byteCount Size of each range, in bytes
+///
+////////////////////////////////////////////////////////////
+void swapPixels(std::uint8_t* first, std::uint8_t* second, std::size_t byteCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the color components of pixels to white, keeping their alpha
+///
+/// \param pixels     Pixels to process
+/// \param pixelCount Number of pixels
+///
+////////////////////////////////////////////////////////////
+void whitenPixels(std::uint8_t* pixels, std::size_t pixelCount);
+
+} // namespace sf::priv
@@ -28,6 +28,8 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
@@ -38,9 +40,13 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <mutex>
+#include <optional>
 #include <ostream>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cmath>
@@ -53,6 +59,7 @@ namespace
 namespace RenderTargetImpl
 {
 // Mutex to protect ID generation and our context-RenderTarget-map
+// The draw hot path only locks it when the per-thread fast path of isActive fails
 std::recursive_mutex& getMutex()
 {
     static std::recursive_mutex mutex;
@@ -77,11 +84,65 @@ ContextRenderTargetMap& getContextRenderTargetMap()
     return contextRenderTargetMap;
 }
 
+// Generation of our context-RenderTarget-map, incremented every time
+// an entry changes so that per-thread copies can detect they are stale
+std::atomic<std::uint64_t>& getContextRenderTargetMapGeneration()
+{
+    static std::atomic<std::uint64_t> generation(0);
+    return generation;
+}
+
+// Per-thread copy of the last context-RenderTarget association
+// that was found in (or written to) our context-RenderTarget-map
+struct ActiveRenderTarget
+{
+    std::uint64_t contextId{};      //!< Context the RenderTarget was active in
+    std::uint64_t renderTargetId{}; //!< RenderTarget that was active in the context
+    std::uint64_t generation{};     //!< Generation of the map when the association was read
+
+    // This per-thread variable holds the last known active RenderTarget for each thread
+    static ActiveRenderTarget& get()
+    {
+        thread_local ActiveRenderTarget activeRenderTarget;
+        return activeRenderTarget;
+    }
+};
+
+// Update the per-thread copy of the context-RenderTarget association
+// Our mutex must be locked when calling this function
+void setActiveRenderTarget(std::uint64_t contextId, std::uint64_t id)
+{
+    ActiveRenderTarget& activeRenderTarget = ActiveRenderTarget::get();
+
+    activeRenderTarget.contextId      = contextId;
+    activeRenderTarget.renderTargetId = id;
+    activeRenderTarget.generation     = getContextRenderTargetMapGeneration().load(std::memory_order_acquire);
+}
+
 // Check if a RenderTarget with the given ID is active in the current context
 bool isActive(std::uint64_t id)
 {
-    const auto it = getContextRenderTargetMap().find(sf::Context::getActiveContextId());
-    return (it != getContextRenderTargetMap().end()) && (it->second == id);
+    // Fast path: nothing changed since this thread last looked at the map
+    // A context is only current in a single thread at a time, but it can migrate between
+    // threads, so the generation must be checked to make sure that no other thread
+    // activated another RenderTarget in our context in the meantime
+    const ActiveRenderTarget& activeRenderTarget = ActiveRenderTarget::get();
+    if ((activeRenderTarget.renderTargetId == id) &&
+        (activeRenderTarget.generation == getContextRenderTargetMapGeneration().load(std::memory_order_acquire)) &&
+        (activeRenderTarget.contextId == sf::Context::getActiveContextId()))
+        return true;
+
+    // Slow path: look the context up in the map
+    const std::lock_guard lock(getMutex());
+
+    const std::uint64_t contextId = sf::Context::getActiveContextId();
+    const auto          it        = getContextRenderTargetMap().find(contextId);
+
+    if ((it == getContextRenderTargetMap().end()) || (it->second != id))
+        return false;
+
+    setActiveRenderTarget(contextId, id);
+    return true;
 }
 
 // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
@@ -190,6 +251,148 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
     assert(false);
     return GL_ALWAYS;
 }
+
+
+// Convert a PrimitiveType constant to the corresponding OpenGL constant.
+GLenum primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[static_cast<std::size_t>(type)];
+}
+
+
+// Get the list primitive type that draws the same primitives as the given type
+sf::PrimitiveType toListPrimitive(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::LineStrip:
+            return sf::PrimitiveType::Lines;
+        case sf::PrimitiveType::TriangleStrip:
+        case sf::PrimitiveType::TriangleFan:
+            return sf::PrimitiveType::Triangles;
+        default:
+            return type;
+    }
+}
+
+
+// Check whether a rectangle, expressed in the coordinate system of a transform,
+// overlaps the area of the target visible through a view
+bool isInView(const sf::FloatRect& bounds, const sf::Transform& transform, const sf::View& view)
+{
+    // Bring the bounds into normalized device coordinates, where the viewport spans [-1, 1] on both axes
+    const sf::FloatRect deviceBounds = (view.getTransform() * transform).transformRect(bounds);
+
+    // The scissor rectangle may hide a part of the viewport
+    const sf::FloatRect& viewport = view.getViewport();
+    const sf::FloatRect& scissor  = view.getScissor();
+    const float left   = std::max(-1.f, (scissor.left - viewport.left) / viewport.width * 2.f - 1.f);
+    const float right  = std::min(1.f, (scissor.left + scissor.width - viewport.left) / viewport.width * 2.f - 1.f);
+    const float bottom = std::max(-1.f, 1.f - (scissor.top + scissor.height - viewport.top) / viewport.height * 2.f);
+    const float top    = std::min(1.f, 1.f - (scissor.top - viewport.top) / viewport.height * 2.f);
+
+    // Touching edges count as overlapping, so that degenerate bounds (lines, points) are kept
+    return (deviceBounds.left <= right) && (deviceBounds.left + deviceBounds.width >= left) &&
+           (deviceBounds.top <= top) && (deviceBounds.top + deviceBounds.height >= bottom);
+}
+
+
+// Append the vertices of one instance to a list of primitives,
+// unrolling strips and fans so that instances stay disconnected
+void appendInstance(std::vector<sf::Vertex>& output,
+                    const sf::Vertex*        vertices,
+                    std::size_t              vertexCount,
+                    sf::PrimitiveType        type,
+                    const sf::Transform&     transform,
+                    sf::Color                color)
+{
+    const auto append = [&](const sf::Vertex& vertex)
+    { output.push_back({transform * vertex.position, vertex.color * color, vertex.texCoords}); };
+
+    switch (type)
+    {
+        case sf::PrimitiveType::LineStrip:
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                append(vertices[i - 1]);
+                append(vertices[i]);
+            }
+            break;
+        case sf::PrimitiveType::TriangleStrip:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(vertices[i - 2]);
+                append(vertices[i - 1]);
+                append(vertices[i]);
+            }
+            break;
+        case sf::PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(vertices[0]);
+                append(vertices[i - 1]);
+                append(vertices[i]);
+            }
+            break;
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::Triangles:
+        case sf::PrimitiveType::Points:
+        {
+            // Drop incomplete primitives, they would shift the vertices of the next instance
+            const std::size_t verticesPerPrimitive = (type == sf::PrimitiveType::Lines)       ? 2
+                                                     : (type == sf::PrimitiveType::Triangles) ? 3
+                                                                                              : 1;
+            for (std::size_t i = 0; i < vertexCount - vertexCount % verticesPerPrimitive; ++i)
+                append(vertices[i]);
+            break;
+        }
+    }
+}
+
+#ifndef SFML_OPENGL_ES
+
+// Shader applying the transform and color of each instance before the fixed pipeline ones
+const char* const instancingVertexShader = R"(
+attribute vec3 sf_instanceRow0;
+attribute vec3 sf_instanceRow1;
+attribute vec4 sf_instanceColor;
+
+void main()
+{
+    vec3 position = vec3(gl_Vertex.xy, 1.0);
+    vec4 vertex = vec4(dot(sf_instanceRow0, position), dot(sf_instanceRow1, position), 0.0, 1.0);
+    gl_Position = gl_ModelViewProjectionMatrix * vertex;
+    gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;
+    gl_FrontColor = gl_Color * sf_instanceColor;
+}
+)";
+
+const char* const instancingFragmentShader = R"(
+uniform sampler2D texture;
+uniform bool textured;
+
+void main()
+{
+    gl_FragColor = textured ? gl_Color * texture2D(texture, gl_TexCoord[0].xy) : gl_Color;
+}
+)";
+
+// Retrieve the location of an attribute of a linked shader program
+GLint getAttribLocation(unsigned int program, const char* name)
+{
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+    const auto handle = reinterpret_cast<GLEXT_GLhandle>(static_cast<std::ptrdiff_t>(program));
+#else
+    const auto handle = static_cast<GLEXT_GLhandle>(program);
+#endif
+
+    GLint location = -1;
+    glCheck(location = GLEXT_glGetAttribLocation(handle, name));
+    return location;
+}
+
+#endif
 } // namespace RenderTargetImpl
 } // namespace
 
@@ -199,6 +402,9 @@ namespace sf
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color)
 {
+    // Clearing with a color starts a new frame
+    m_cullingStatistics = {};
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -235,6 +441,9 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color, StencilValue stencilValue)
 {
+    // Clearing with a color starts a new frame
+    m_cullingStatistics = {};
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -338,6 +547,20 @@ Vector2i RenderTarget::mapCoordsToPixel(const Vector2f& point, const View& view)
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const Drawable& drawable, const RenderStates& states)
 {
+    if (m_cullingEnabled)
+    {
+        if (const std::optional<FloatRect> bounds = drawable.getCullingBounds())
+        {
+            if (!RenderTargetImpl::isInView(*bounds, states.transform, m_view))
+            {
+                ++m_cullingStatistics.culled;
+                return;
+            }
+
+            ++m_cullingStatistics.submitted;
+        }
+    }
+
     drawable.draw(*this, states);
 }
 
@@ -351,75 +574,107 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
 
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
-        // Check if the vertex count is low enough so that we can pre-transform them
-        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
+        setupVertexArray(vertices, vertexCount, states);
+        drawPrimitives(type, 0, vertexCount);
+        cleanupDraw(states);
+    }
+}
 
-        if (useVertexCache)
-        {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
-        }
 
-        setupDraw(useVertexCache, states);
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+}
 
-        // Check if texture coordinates array is needed, and update client state accordingly
-        const bool enableTexCoordsArray = (states.texture || states.shader);
-        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
-        {
-            if (enableTexCoordsArray)
-                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-            else
-                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
-        }
 
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
-        {
-            const auto* data = reinterpret_cast<const std::byte*>(vertices);
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
 
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+    // Sanity check
+    if (firstVertex > vertexBuffer.getVertexCount())
+        return;
 
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            if (enableTexCoordsArray)
-                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
-        {
-            // If we enter this block, we are already using our internal vertex cache
-            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+    // Clamp vertexCount to something that makes sense
+    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
 
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
+    // Nothing to draw?
+    if (!vertexCount || !vertexBuffer.getNativeHandle())
+        return;
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        setupDraw(false, states);
+
+        // Bind vertex buffer
+        VertexBuffer::bind(&vertexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+        drawPrimitives(vertexBuffer.getPrimitiveType(), vertexBuffer.m_firstVertex + firstVertex, vertexCount);
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(nullptr);
 
-        drawPrimitives(type, 0, vertexCount);
         cleanupDraw(states);
 
         // Update the cache
-        m_cache.useVertexCache        = useVertexCache;
-        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint16_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
 {
-    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+    drawIndexed(vertices, vertexCount, indices, sizeof(std::uint16_t), indexCount, type, states);
 }
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint32_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    drawIndexed(vertices, vertexCount, indices, sizeof(std::uint32_t), indexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
 {
     // VertexBuffer not supported?
     if (!VertexBuffer::isAvailable())
@@ -429,20 +684,169 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     }
 
     // Sanity check
-    if (firstVertex > vertexBuffer.getVertexCount())
+    if (firstIndex > indexBuffer.getIndexCount())
         return;
 
-    // Clamp vertexCount to something that makes sense
-    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
 
     // Nothing to draw?
-    if (!vertexCount || !vertexBuffer.getNativeHandle())
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
         return;
 
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         setupDraw(false, states);
 
+        // Bind vertex and index buffers
+        VertexBuffer::bind(&vertexBuffer);
+        IndexBuffer::bind(&indexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        // Indices are relative to the current vertices of the buffer
+        const std::size_t offset = sizeof(Vertex) * vertexBuffer.m_firstVertex;
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(offset + 0)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(offset + 8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(offset + 12)));
+
+        const std::size_t indexSize = (indexBuffer.getIndexType() == IndexBuffer::IndexType::UInt32)
+                                          ? sizeof(std::uint32_t)
+                                          : sizeof(std::uint16_t);
+
+        drawIndexedPrimitives(vertexBuffer.getPrimitiveType(),
+                              reinterpret_cast<const void*>(indexSize * firstIndex),
+                              indexSize,
+                              indexCount);
+
+        // Unbind vertex and index buffers
+        IndexBuffer::bind(nullptr);
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstanced(const Vertex*         vertices,
+                                 std::size_t           vertexCount,
+                                 PrimitiveType         type,
+                                 const InstanceBuffer& instances,
+                                 const RenderStates&   states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || (instances.getInstanceCount() == 0))
+        return;
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        // A shader that uses none of the instance attributes can't place the instances itself
+        const auto               isUsed         = [](int location) { return location >= 0; };
+        const std::array<int, 3> attributes     = getInstanceAttributes(states.shader);
+        const bool               hasAttributes  = std::any_of(attributes.begin(), attributes.end(), isUsed);
+        const unsigned int       instanceBuffer = hasAttributes ? instances.upload() : 0;
+
+        if (!instanceBuffer)
+        {
+            drawExpandedInstances(vertices, vertexCount, type, instances, states);
+            return;
+        }
+
+        RenderStates instancingStates = states;
+
+        if (!states.shader)
+        {
+            m_instancingShader->setUniform("textured", states.texture != nullptr);
+            instancingStates.shader = m_instancingShader.get();
+        }
+
+        setupDraw(false, instancingStates);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        const auto* data = reinterpret_cast<const std::byte*>(vertices);
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+
+        drawInstancedPrimitives(type, 0, vertexCount, attributes, instanceBuffer, instances.getInstanceCount());
+
+        cleanupDraw(instancingStates);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstanced(const VertexBuffer&   vertexBuffer,
+                                 const InstanceBuffer& instances,
+                                 const RenderStates&   states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    const std::size_t vertexCount = vertexBuffer.getVertexCount();
+
+    // Nothing to draw?
+    if (!vertexCount || !vertexBuffer.getNativeHandle() || (instances.getInstanceCount() == 0))
+        return;
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        // A shader that uses none of the instance attributes can't place the instances itself
+        const auto               isUsed         = [](int location) { return location >= 0; };
+        const std::array<int, 3> attributes     = getInstanceAttributes(states.shader);
+        const bool               hasAttributes  = std::any_of(attributes.begin(), attributes.end(), isUsed);
+        const unsigned int       instanceBuffer = hasAttributes ? instances.upload() : 0;
+
+        if (!instanceBuffer)
+        {
+#ifndef SFML_OPENGL_ES
+            // Read the vertices back so that they can be expanded on the CPU
+            std::vector<Vertex> vertices(vertexCount);
+
+            VertexBuffer::bind(&vertexBuffer);
+            glCheck(GLEXT_glGetBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                             static_cast<GLintptrARB>(sizeof(Vertex) * vertexBuffer.m_firstVertex),
+                                             static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                             vertices.data()));
+            VertexBuffer::bind(nullptr);
+
+            drawExpandedInstances(vertices.data(), vertexCount, vertexBuffer.getPrimitiveType(), instances, states);
+#else
+            err() << "Instanced drawing of a sf::VertexBuffer is not available, drawing skipped" << std::endl;
+#endif
+            return;
+        }
+
+        RenderStates instancingStates = states;
+
+        if (!states.shader)
+        {
+            m_instancingShader->setUniform("textured", states.texture != nullptr);
+            instancingStates.shader = m_instancingShader.get();
+        }
+
+        setupDraw(false, instancingStates);
+
         // Bind vertex buffer
         VertexBuffer::bind(&vertexBuffer);
 
@@ -454,12 +858,17 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
         glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
         glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
 
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+        drawInstancedPrimitives(vertexBuffer.getPrimitiveType(),
+                                vertexBuffer.m_firstVertex,
+                                vertexCount,
+                                attributes,
+                                instanceBuffer,
+                                instances.getInstanceCount());
 
         // Unbind vertex buffer
         VertexBuffer::bind(nullptr);
 
-        cleanupDraw(states);
+        cleanupDraw(instancingStates);
 
         // Update the cache
         m_cache.useVertexCache        = false;
@@ -468,6 +877,27 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setCullingEnabled(bool enabled)
+{
+    m_cullingEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isCullingEnabled() const
+{
+    return m_cullingEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::CullingStatistics& RenderTarget::getCullingStatistics() const
+{
+    return m_cullingStatistics;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::isSrgb() const
 {
@@ -479,6 +909,10 @@ bool RenderTarget::isSrgb() const
 ////////////////////////////////////////////////////////////
 bool RenderTarget::setActive(bool active)
 {
+    // Nothing to do if this RenderTarget is already active in the current context
+    if (active && RenderTargetImpl::isActive(m_id))
+        return true;
+
     // Mark this RenderTarget as active or no longer active in the tracking map
     {
         const std::lock_guard lock(RenderTargetImpl::getMutex());
@@ -486,6 +920,7 @@ bool RenderTarget::setActive(bool active)
         const std::uint64_t contextId = Context::getActiveContextId();
 
         using RenderTargetImpl::getContextRenderTargetMap;
+        using RenderTargetImpl::getContextRenderTargetMapGeneration;
         auto&      contextRenderTargetMap = getContextRenderTargetMap();
         const auto it                     = contextRenderTargetMap.find(contextId);
 
@@ -494,6 +929,7 @@ bool RenderTarget::setActive(bool active)
             if (it == contextRenderTargetMap.end())
             {
                 contextRenderTargetMap[contextId] = m_id;
+                getContextRenderTargetMapGeneration().fetch_add(1, std::memory_order_acq_rel);
 
                 m_cache.glStatesSet = false;
                 m_cache.enable      = false;
@@ -501,14 +937,22 @@ bool RenderTarget::setActive(bool active)
             else if (it->second != m_id)
             {
                 it->second = m_id;
+                getContextRenderTargetMapGeneration().fetch_add(1, std::memory_order_acq_rel);
 
                 m_cache.enable = false;
             }
+
+            RenderTargetImpl::setActiveRenderTarget(contextId, m_id);
         }
         else
         {
             if (it != contextRenderTargetMap.end())
+            {
                 contextRenderTargetMap.erase(it);
+                getContextRenderTargetMapGeneration().fetch_add(1, std::memory_order_acq_rel);
+            }
+
+            RenderTargetImpl::setActiveRenderTarget(0, 0);
 
             m_cache.enable = false;
         }
@@ -885,18 +1329,276 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexed(const Vertex*       vertices,
+                               std::size_t         vertexCount,
+                               const void*         indices,
+                               std::size_t         indexSize,
+                               std::size_t         indexCount,
+                               PrimitiveType       type,
+                               const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || !vertexCount || !indices || !indexCount)
+        return;
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        setupVertexArray(vertices, vertexCount, states);
+        drawIndexedPrimitives(type, indices, indexSize, indexCount);
+        cleanupDraw(states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setupVertexArray(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states)
+{
+    // Check if the vertex count is low enough so that we can pre-transform them
+    const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
+
+    if (useVertexCache)
+    {
+        // Pre-transform the vertices and store them into the vertex cache
+        std::copy(vertices, vertices + vertexCount, m_cache.vertexCache.begin());
+        states.transform.transformVertices(m_cache.vertexCache.data(), vertexCount);
+    }
+
+    setupDraw(useVertexCache, states);
+
+    // Check if texture coordinates array is needed, and update client state accordingly
+    const bool enableTexCoordsArray = (states.texture || states.shader);
+    if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+    {
+        if (enableTexCoordsArray)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        else
+            glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+    }
+
+    // If we switch between non-cache and cache mode or enable texture
+    // coordinates we need to set up the pointers to the vertices' components
+    if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+    {
+        const auto* data = reinterpret_cast<const std::byte*>(vertices);
+
+        // If we pre-transform the vertices, we must use our internal vertex cache
+        if (useVertexCache)
+            data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+        if (enableTexCoordsArray)
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+    }
+    else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+    {
+        // If we enter this block, we are already using our internal vertex cache
+        const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+    }
+
+    // Update the cache
+    m_cache.useVertexCache        = useVertexCache;
+    m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
     // Find the OpenGL primitive type
-    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum            mode = modes[static_cast<std::size_t>(type)];
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
 
     // Draw the primitives
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType type, const void* indices, std::size_t indexSize, std::size_t indexCount)
+{
+    // Find the OpenGL primitive and index types
+    const GLenum mode      = RenderTargetImpl::primitiveTypeToGlConstant(type);
+    const GLenum indexType = (indexSize == sizeof(std::uint32_t)) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+
+    // Draw the primitives
+    glCheck(glDrawElements(mode, static_cast<GLsizei>(indexCount), indexType, indices));
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstancedPrimitives(PrimitiveType             type,
+                                           std::size_t               firstVertex,
+                                           std::size_t               vertexCount,
+                                           const std::array<int, 3>& attributes,
+                                           unsigned int              instanceBuffer,
+                                           std::size_t               instanceCount)
+{
+#ifndef SFML_OPENGL_ES
+    using Instance = InstanceBuffer::Instance;
+
+    // Layout of the rows of the transform and of the color of each instance
+    static constexpr std::array<GLint, 3>       sizes      = {3, 3, 4};
+    static constexpr std::array<GLenum, 3>      types      = {GL_FLOAT, GL_FLOAT, GL_UNSIGNED_BYTE};
+    static constexpr std::array<GLboolean, 3>   normalized = {GL_FALSE, GL_FALSE, GL_TRUE};
+    static constexpr std::array<std::size_t, 3> offsets    = {offsetof(Instance, row0),
+                                                              offsetof(Instance, row1),
+                                                              offsetof(Instance, color)};
+
+    // Advance the instance attributes once per instance instead of once per vertex
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, instanceBuffer));
+
+    for (std::size_t i = 0; i < attributes.size(); ++i)
+    {
+        // The shader doesn't use this attribute
+        if (attributes[i] < 0)
+            continue;
+
+        const auto location = static_cast<GLuint>(attributes[i]);
+
+        glCheck(GLEXT_glEnableVertexAttribArray(location));
+        glCheck(GLEXT_glVertexAttribPointer(location,
+                                            sizes[i],
+                                            types[i],
+                                            normalized[i],
+                                            sizeof(Instance),
+                                            reinterpret_cast<const void*>(offsets[i])));
+        glCheck(GLEXT_glVertexAttribDivisor(location, 1));
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    // Draw all the instances at once
+    glCheck(GLEXT_glDrawArraysInstanced(RenderTargetImpl::primitiveTypeToGlConstant(type),
+                                        static_cast<GLint>(firstVertex),
+                                        static_cast<GLsizei>(vertexCount),
+                                        static_cast<GLsizei>(instanceCount)));
+
+    // Restore the attributes, the fixed pipeline doesn't expect divisors
+    for (const int attribute : attributes)
+    {
+        if (attribute < 0)
+            continue;
+
+        const auto location = static_cast<GLuint>(attribute);
+
+        glCheck(GLEXT_glVertexAttribDivisor(location, 0));
+        glCheck(GLEXT_glDisableVertexAttribArray(location));
+    }
+#else
+    // getInstancingShader() never provides a shader on OpenGL ES
+    static_cast<void>(type);
+    static_cast<void>(firstVertex);
+    static_cast<void>(vertexCount);
+    static_cast<void>(attributes);
+    static_cast<void>(instanceBuffer);
+    static_cast<void>(instanceCount);
+    assert(false && "Instanced drawing is not supported on OpenGL ES");
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawExpandedInstances(const Vertex*         vertices,
+                                         std::size_t           vertexCount,
+                                         PrimitiveType         type,
+                                         const InstanceBuffer& instances,
+                                         const RenderStates&   states)
+{
+#ifndef SFML_OPENGL_ES
+    // A custom shader may declare the instance attributes, make them the identity so
+    // that they leave the vertices that are already transformed on the CPU unchanged
+    if (states.shader)
+    {
+        const unsigned int program = states.shader->getNativeHandle();
+
+        if (const GLint location = RenderTargetImpl::getAttribLocation(program, "sf_instanceRow0"); location >= 0)
+            glCheck(GLEXT_glVertexAttrib3f(static_cast<GLuint>(location), 1.f, 0.f, 0.f));
+
+        if (const GLint location = RenderTargetImpl::getAttribLocation(program, "sf_instanceRow1"); location >= 0)
+            glCheck(GLEXT_glVertexAttrib3f(static_cast<GLuint>(location), 0.f, 1.f, 0.f));
+
+        if (const GLint location = RenderTargetImpl::getAttribLocation(program, "sf_instanceColor"); location >= 0)
+            glCheck(GLEXT_glVertexAttrib4f(static_cast<GLuint>(location), 1.f, 1.f, 1.f, 1.f));
+    }
+#endif
+
+    // Our scratch array keeps its capacity, so drawing the same instances every frame doesn't allocate
+    m_instanceVertices.clear();
+
+    for (std::size_t i = 0; i < instances.getInstanceCount(); ++i)
+    {
+        RenderTargetImpl::appendInstance(m_instanceVertices,
+                                         vertices,
+                                         vertexCount,
+                                         type,
+                                         instances.getTransform(i),
+                                         instances.getColor(i));
+    }
+
+    draw(m_instanceVertices.data(), m_instanceVertices.size(), RenderTargetImpl::toListPrimitive(type), states);
+}
+
+
+////////////////////////////////////////////////////////////
+Shader* RenderTarget::getInstancingShader()
+{
+    if (!m_instancingShaderLoadAttempted)
+    {
+        m_instancingShaderLoadAttempted = true;
+
+#ifndef SFML_OPENGL_ES
+        // The instance attributes require hardware instancing, which is core since OpenGL 3.3
+        if (Shader::isAvailable() && GLEXT_instanced_arrays)
+        {
+            if (auto shader = Shader::loadFromMemory(RenderTargetImpl::instancingVertexShader,
+                                                     RenderTargetImpl::instancingFragmentShader))
+            {
+                const unsigned int program = shader->getNativeHandle();
+
+                m_instanceAttributes = {RenderTargetImpl::getAttribLocation(program, "sf_instanceRow0"),
+                                        RenderTargetImpl::getAttribLocation(program, "sf_instanceRow1"),
+                                        RenderTargetImpl::getAttribLocation(program, "sf_instanceColor")};
+
+                shader->setUniform("texture", Shader::CurrentTexture);
+                m_instancingShader = std::make_shared<Shader>(std::move(*shader));
+            }
+            else
+            {
+                err() << "Failed to compile the instancing shader, instances will be expanded on the CPU" << std::endl;
+            }
+        }
+#endif
+    }
+
+    return m_instancingShader.get();
+}
+
+
+////////////////////////////////////////////////////////////
+std::array<int, 3> RenderTarget::getInstanceAttributes(const Shader* shader)
+{
+    if (!shader)
+        return getInstancingShader() ? m_instanceAttributes : std::array{-1, -1, -1};
+
+#ifndef SFML_OPENGL_ES
+    // The instance attributes require hardware instancing, which is core since OpenGL 3.3
+    if (GLEXT_instanced_arrays)
+    {
+        const unsigned int program = shader->getNativeHandle();
+
+        return {RenderTargetImpl::getAttribLocation(program, "sf_instanceRow0"),
+                RenderTargetImpl::getAttribLocation(program, "sf_instanceRow1"),
+                RenderTargetImpl::getAttribLocation(program, "sf_instanceColor")};
+    }
+#endif
+
+    return {-1, -1, -1};
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::cleanupDraw(const RenderStates& states)
 {
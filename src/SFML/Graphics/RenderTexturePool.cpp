@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTexturePool.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <memory>
+
+#include <cassert>
+
+
+namespace
+{
+// Round a size up to a multiple of the bucket size
+sf::Vector2u getBucket(const sf::Vector2u& size, unsigned int bucketSize)
+{
+    return {(size.x + bucketSize - 1) / bucketSize * bucketSize, (size.y + bucketSize - 1) / bucketSize * bucketSize};
+}
+
+
+// Check whether render textures created with two sets of settings are interchangeable
+bool isSameSettings(const sf::ContextSettings& left, const sf::ContextSettings& right)
+{
+    return (left.depthBits == right.depthBits) && (left.stencilBits == right.stencilBits) &&
+           (left.antialiasingLevel == right.antialiasingLevel) && (left.majorVersion == right.majorVersion) &&
+           (left.minorVersion == right.minorVersion) && (left.attributeFlags == right.attributeFlags) &&
+           (left.sRgbCapable == right.sRgbCapable);
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct RenderTexturePool::Entry
+{
+    std::unique_ptr<RenderTexture> renderTexture; //!< Render texture owned by the pool
+    Vector2u                       bucket;        //!< Actual size of the render texture
+    ContextSettings                settings;      //!< Settings the render texture was created with
+    bool                           inUse{};       //!< Is the render texture currently acquired?
+};
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool(unsigned int bucketSize) : m_bucketSize(std::max(bucketSize, 1u))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::~RenderTexturePool() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool(RenderTexturePool&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool& RenderTexturePool::operator=(RenderTexturePool&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(const Vector2u& size, const ContextSettings& settings)
+{
+    const Vector2u bucket = getBucket(size, m_bucketSize);
+
+    // Look for an unused render texture of the same bucket and settings
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const Entry& entry)
+                                 {
+                                     return !entry.inUse && (entry.bucket == bucket) &&
+                                            isSameSettings(entry.settings, settings);
+                                 });
+
+    RenderTexture* renderTexture = nullptr;
+
+    if (it != m_entries.end())
+    {
+        it->inUse     = true;
+        renderTexture = it->renderTexture.get();
+        renderTexture->setSmooth(false);
+        renderTexture->setRepeated(false);
+        ++m_statistics.reused;
+    }
+    else
+    {
+        auto newRenderTexture = std::make_unique<RenderTexture>();
+        if (!newRenderTexture->create(bucket, settings))
+            return nullptr;
+
+        renderTexture = newRenderTexture.get();
+        m_entries.push_back({std::move(newRenderTexture), bucket, settings, true});
+        ++m_statistics.created;
+    }
+
+    // Map the default coordinates to the requested area, in the top-left corner of the render texture
+    View view(FloatRect({0, 0}, Vector2f(size)));
+    if (bucket != size)
+        view.setViewport(FloatRect({0, 0},
+                                   {static_cast<float>(size.x) / static_cast<float>(bucket.x),
+                                    static_cast<float>(size.y) / static_cast<float>(bucket.y)}));
+    renderTexture->setView(view);
+
+    return renderTexture;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::recycle(RenderTexture& renderTexture)
+{
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const Entry& entry) { return entry.renderTexture.get() == &renderTexture; });
+
+    assert(it != m_entries.end() && "Render texture was not acquired from this pool");
+    assert(it->inUse && "Render texture was already recycled");
+
+    it->inUse = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::releaseUnused()
+{
+    m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) { return !entry.inUse; }),
+                    m_entries.end());
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RenderTexturePool::getBucketSize() const
+{
+    return m_bucketSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getInUseCount() const
+{
+    return static_cast<std::size_t>(
+        std::count_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) { return entry.inUse; }));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getAvailableCount() const
+{
+    return m_entries.size() - getInUseCount();
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTexturePool::Statistics& RenderTexturePool::getStatistics() const
+{
+    return m_statistics;
+}
+
+} // namespace sf
@@ -30,6 +30,7 @@
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 
 #include <SFML/Window/GlResource.hpp>
 
@@ -39,14 +40,55 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <mutex>
 #include <ostream>
+#include <sstream>
+#include <system_error>
 #include <utility>
 #include <vector>
 
+#include <cassert>
 #include <cstdint>
 
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct Shader::UniformSlot
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Type of the staged value
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        Float1,
+        Float2,
+        Float3,
+        Float4,
+        Int1,
+        Int2,
+        Int3,
+        Int4,
+        Mat3,
+        Mat4
+    };
+
+    int                   location{-1}; //!< Location of the uniform in the program, -1 if not found
+    Type                  type{};       //!< Type of the staged value
+    std::array<float, 16> floats{};     //!< Staged float components, or matrix elements
+    std::array<int, 4>    ints{};       //!< Staged int components
+    bool                  staged{};     //!< Is a value waiting to be uploaded?
+};
+
+} // namespace sf
+
 #ifndef SFML_OPENGL_ES
 
 #if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
@@ -77,6 +119,166 @@ std::size_t getMaxTextureUnits()
     return static_cast<std::size_t>(maxUnits);
 }
 
+// Retrieve the maximum number of uniform buffer binding points available
+std::size_t getMaxUniformBufferBindings()
+{
+    static const GLint maxBindings = []()
+    {
+        GLint value = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS, &value));
+
+        return value;
+    }();
+
+    return static_cast<std::size_t>(maxBindings);
+}
+
+// State of the program binary cache, shared by all shaders
+struct ProgramCache
+{
+    std::mutex               mutex;     //!< Mutex protecting the directory
+    std::filesystem::path    directory; //!< Directory of the binaries, empty if the cache is disabled
+    std::atomic<std::size_t> hits{};    //!< Number of programs loaded from the cache
+    std::atomic<std::size_t> misses{};  //!< Number of programs not found in the cache
+
+    static ProgramCache& get()
+    {
+        static ProgramCache cache;
+        return cache;
+    }
+};
+
+// Magic number at the beginning of our program binary files
+constexpr std::array<char, 4> programBinaryMagic = {'S', 'F', 'P', 'B'};
+
+// Get the path of the cache file of a program, from its sources and the current driver
+std::filesystem::path getProgramBinaryPath(const std::filesystem::path& directory,
+                                           const char*                  vertexShaderCode,
+                                           const char*                  geometryShaderCode,
+                                           const char*                  fragmentShaderCode)
+{
+    // 64-bit FNV-1a
+    std::uint64_t hash    = 14695981039346656037u;
+    const auto    combine = [&hash](const char* string)
+    {
+        for (; string && *string; ++string)
+        {
+            hash ^= static_cast<unsigned char>(*string);
+            hash *= 1099511628211u;
+        }
+
+        // Separate the strings, so that moving a source to another stage changes the hash
+        hash ^= 0xFFu;
+        hash *= 1099511628211u;
+    };
+
+    combine(vertexShaderCode);
+    combine(geometryShaderCode);
+    combine(fragmentShaderCode);
+
+    // Binaries can only be reused by the driver which produced them
+    for (const GLenum name : std::array<GLenum, 3>{GL_VENDOR, GL_RENDERER, GL_VERSION})
+    {
+        const GLubyte* string = nullptr;
+        glCheck(string = glGetString(name));
+        combine(reinterpret_cast<const char*>(string));
+    }
+
+    std::ostringstream filename;
+    filename << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+
+    return directory / filename.str();
+}
+
+// Create a program from a cached binary, returns 0 if there is no usable binary
+unsigned int loadProgramBinary(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios_base::binary);
+    if (!file)
+        return 0;
+
+    std::array<char, 4> magic{};
+    std::uint32_t       format = 0;
+    file.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    file.read(reinterpret_cast<char*>(&format), sizeof(format));
+    if (!file || (magic != programBinaryMagic))
+        return 0;
+
+    const std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (binary.empty())
+        return 0;
+
+    // Passing a format that the driver doesn't support (anymore) is an error, check it first
+    GLint formatCount = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+    if (formatCount <= 0)
+        return 0;
+
+    std::vector<GLint> formats(static_cast<std::size_t>(formatCount));
+    glCheck(glGetIntegerv(GLEXT_GL_PROGRAM_BINARY_FORMATS, formats.data()));
+    if (std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) == formats.end())
+        return 0;
+
+    GLEXT_GLhandle program{};
+    glCheck(program = GLEXT_glCreateProgramObject());
+    glCheck(GLEXT_glProgramBinary(castFromGlHandle(program),
+                                  static_cast<GLenum>(format),
+                                  binary.data(),
+                                  static_cast<GLsizei>(binary.size())));
+
+    // The driver reports a link failure for binaries it can't use, e.g. after it was updated
+    GLint success = 0;
+    glCheck(GLEXT_glGetObjectParameteriv(program, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        glCheck(GLEXT_glDeleteObject(program));
+        return 0;
+    }
+
+    return castFromGlHandle(program);
+}
+
+// Save the binary of a linked program to the cache
+void saveProgramBinary(const std::filesystem::path& path, unsigned int program)
+{
+    GLint length = 0;
+    glCheck(GLEXT_glGetProgramiv(program, GLEXT_GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum            format = 0;
+    glCheck(GLEXT_glGetProgramBinary(program, length, nullptr, &format, binary.data()));
+
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    // Write to a temporary file first, so that a partially written binary is never loaded
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp";
+
+    {
+        const auto    formatValue = static_cast<std::uint32_t>(format);
+        std::ofstream file(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+        file.write(programBinaryMagic.data(), static_cast<std::streamsize>(programBinaryMagic.size()));
+        file.write(reinterpret_cast<const char*>(&formatValue), sizeof(formatValue));
+        file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+
+        if (!file)
+        {
+            sf::err() << "Failed to write program binary to cache\n"
+                      << sf::formatDebugPathInfo(temporaryPath) << std::endl;
+            file.close();
+            std::filesystem::remove(temporaryPath, error);
+            return;
+        }
+    }
+
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error)
+        std::filesystem::remove(temporaryPath, error);
+}
+
 // Read the contents of a file into an array of char
 bool getFileContents(const std::filesystem::path& filename, std::vector<char>& buffer)
 {
@@ -191,7 +393,10 @@ struct Shader::UniformBinder
                 glCheck(GLEXT_glUseProgramObject(currentProgram));
 
             // Store uniform location for further use outside constructor
-            location = shader.getUniformLocation(name);
+            // A value staged through a handle is older than this one, drop it
+            UniformSlot& slot = shader.m_uniformSlots[shader.getUniformSlot(name)];
+            slot.staged       = false;
+            location          = slot.location;
         }
     }
 
@@ -240,7 +445,10 @@ Shader::Shader(Shader&& source) noexcept :
 m_shaderProgram(std::exchange(source.m_shaderProgram, 0U)),
 m_currentTexture(std::exchange(source.m_currentTexture, -1)),
 m_textures(std::move(source.m_textures)),
-m_uniforms(std::move(source.m_uniforms))
+m_uniforms(std::move(source.m_uniforms)),
+m_uniformSlots(std::move(source.m_uniformSlots)),
+m_stagedUniforms(std::move(source.m_stagedUniforms)),
+m_uniformBlocks(std::move(source.m_uniformBlocks))
 {
 }
 
@@ -265,6 +473,9 @@ Shader& Shader::operator=(Shader&& right) noexcept
     m_currentTexture = std::exchange(right.m_currentTexture, -1);
     m_textures       = std::move(right.m_textures);
     m_uniforms       = std::move(right.m_uniforms);
+    m_uniformSlots   = std::move(right.m_uniformSlots);
+    m_stagedUniforms = std::move(right.m_stagedUniforms);
+    m_uniformBlocks  = std::move(right.m_uniformBlocks);
     return *this;
 }
 
@@ -696,6 +907,203 @@ void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixAr
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlock(const std::string& name, const UniformBuffer& buffer)
+{
+    if (m_shaderProgram)
+    {
+        if (!UniformBuffer::isAvailable())
+        {
+            err() << "Failed to bind uniform block " << std::quoted(name)
+                  << ": your system doesn't support uniform buffers" << std::endl;
+            return;
+        }
+
+        const TransientContextLock lock;
+
+        // Find the index of the block in the program
+        GLuint blockIndex = GLEXT_GL_INVALID_INDEX;
+        glCheck(blockIndex = GLEXT_glGetUniformBlockIndex(m_shaderProgram, name.c_str()));
+        if (blockIndex == GLEXT_GL_INVALID_INDEX)
+        {
+            err() << "Uniform block " << std::quoted(name) << " not found in shader" << std::endl;
+            return;
+        }
+
+        // Block already bound, just replace the buffer
+        const auto it = std::find_if(m_uniformBlocks.begin(),
+                                     m_uniformBlocks.end(),
+                                     [blockIndex](const auto& block) { return block.first == blockIndex; });
+        if (it != m_uniformBlocks.end())
+        {
+            it->second = &buffer;
+            return;
+        }
+
+        // New entry, make sure there are enough binding points
+        if (m_uniformBlocks.size() >= getMaxUniformBufferBindings())
+        {
+            err() << "Impossible to use uniform block " << std::quoted(name)
+                  << " for shader: all available binding points are used" << std::endl;
+            return;
+        }
+
+        // The block keeps its binding point for the lifetime of the program
+        const auto bindingPoint = static_cast<GLuint>(m_uniformBlocks.size());
+        glCheck(GLEXT_glUniformBlockBinding(m_shaderProgram, blockIndex, bindingPoint));
+        m_uniformBlocks.emplace_back(blockIndex, &buffer);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Shader::UniformHandle> Shader::getUniformHandle(const std::string& name)
+{
+    if (!m_shaderProgram)
+        return std::nullopt;
+
+    const TransientContextLock lock;
+
+    UniformHandle handle;
+    handle.m_slot = getUniformSlot(name);
+
+    if (m_uniformSlots[handle.m_slot].location == -1)
+        return std::nullopt;
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, float x)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Float1;
+    slot.floats[0]    = x;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec2& v)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Float2;
+    slot.floats[0]    = v.x;
+    slot.floats[1]    = v.y;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec3& v)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Float3;
+    slot.floats[0]    = v.x;
+    slot.floats[1]    = v.y;
+    slot.floats[2]    = v.z;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec4& v)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Float4;
+    slot.floats[0]    = v.x;
+    slot.floats[1]    = v.y;
+    slot.floats[2]    = v.z;
+    slot.floats[3]    = v.w;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, int x)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Int1;
+    slot.ints[0]      = x;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec2& v)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Int2;
+    slot.ints[0]      = v.x;
+    slot.ints[1]      = v.y;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec3& v)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Int3;
+    slot.ints[0]      = v.x;
+    slot.ints[1]      = v.y;
+    slot.ints[2]      = v.z;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec4& v)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Int4;
+    slot.ints[0]      = v.x;
+    slot.ints[1]      = v.y;
+    slot.ints[2]      = v.z;
+    slot.ints[3]      = v.w;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, bool x)
+{
+    setUniform(handle, static_cast<int>(x));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec2& v)
+{
+    setUniform(handle, Glsl::Ivec2(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec3& v)
+{
+    setUniform(handle, Glsl::Ivec3(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec4& v)
+{
+    setUniform(handle, Glsl::Ivec4(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat3& matrix)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Mat3;
+    std::copy(matrix.array, matrix.array + 3 * 3, slot.floats.begin());
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat4& matrix)
+{
+    UniformSlot& slot = stageUniform(handle);
+    slot.type         = UniformSlot::Type::Mat4;
+    std::copy(matrix.array, matrix.array + 4 * 4, slot.floats.begin());
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -721,9 +1129,15 @@ void Shader::bind(const Shader* shader)
         // Enable the program
         glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
 
+        // Upload the values set through handles since the last bind
+        shader->uploadStagedUniforms();
+
         // Bind the textures
         shader->bindTextures();
 
+        // Bind the uniform buffers
+        shader->bindUniformBlocks();
+
         // Bind the current texture
         if (shader->m_currentTexture != -1)
             glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
@@ -771,6 +1185,32 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setProgramCacheDirectory(const std::filesystem::path& directory)
+{
+    ProgramCache&         cache = ProgramCache::get();
+    const std::lock_guard lock(cache.mutex);
+    cache.directory = directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getProgramCacheDirectory()
+{
+    ProgramCache&         cache = ProgramCache::get();
+    const std::lock_guard lock(cache.mutex);
+    return cache.directory;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::ProgramCacheStatistics Shader::getProgramCacheStatistics()
+{
+    const ProgramCache& cache = ProgramCache::get();
+    return {cache.hits.load(), cache.misses.load()};
+}
+
+
 ////////////////////////////////////////////////////////////
 Shader::Shader(unsigned int shaderProgram) : m_shaderProgram(shaderProgram)
 {
@@ -798,6 +1238,29 @@ std::optional<Shader> Shader::compile(const char* vertexShaderCode, const char*
         return std::nullopt;
     }
 
+    // Look for a binary of the program in the cache, if enabled
+    std::filesystem::path binaryPath;
+    if (GLEXT_get_program_binary)
+    {
+        if (const std::filesystem::path directory = getProgramCacheDirectory(); !directory.empty())
+        {
+            binaryPath = getProgramBinaryPath(directory, vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+
+            if (const unsigned int program = loadProgramBinary(binaryPath))
+            {
+                ++ProgramCache::get().hits;
+
+                // Force an OpenGL flush, so that the shader will appear updated
+                // in all contexts immediately (solves problems in multi-threaded apps)
+                glCheck(glFlush());
+
+                return Shader(program);
+            }
+
+            ++ProgramCache::get().misses;
+        }
+    }
+
     // Create the program
     GLEXT_GLhandle shaderProgram{};
     glCheck(shaderProgram = GLEXT_glCreateProgramObject());
@@ -882,6 +1345,14 @@ std::optional<Shader> Shader::compile(const char* vertexShaderCode, const char*
         glCheck(GLEXT_glDeleteObject(fragmentShader));
     }
 
+    // Tell the driver that we will retrieve the binary of the program
+    if (!binaryPath.empty())
+    {
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(shaderProgram),
+                                          GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                          GL_TRUE));
+    }
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
@@ -897,6 +1368,10 @@ std::optional<Shader> Shader::compile(const char* vertexShaderCode, const char*
         return std::nullopt;
     }
 
+    // Save the binary of the program for the next time it is loaded
+    if (!binaryPath.empty())
+        saveProgramBinary(binaryPath, castFromGlHandle(shaderProgram));
+
     // Force an OpenGL flush, so that the shader will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
@@ -923,8 +1398,27 @@ void Shader::bindTextures() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+    for (std::size_t i = 0; i < m_uniformBlocks.size(); ++i)
+    {
+        const auto         bindingPoint = static_cast<GLuint>(i);
+        const unsigned int buffer       = m_uniformBlocks[i].second->getNativeHandle();
+        glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER, bindingPoint, buffer));
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 int Shader::getUniformLocation(const std::string& name)
+{
+    return m_uniformSlots[getUniformSlot(name)].location;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Shader::getUniformSlot(const std::string& name)
 {
     // Check the cache
     if (const auto it = m_uniforms.find(name); it != m_uniforms.end())
@@ -936,13 +1430,72 @@ int Shader::getUniformLocation(const std::string& name)
     {
         // Not in cache, request the location from OpenGL
         const int location = GLEXT_glGetUniformLocation(castToGlHandle(m_shaderProgram), name.c_str());
-        m_uniforms.emplace(name, location);
+
+        UniformSlot slot;
+        slot.location = location;
+        m_uniformSlots.push_back(slot);
+        m_uniforms.emplace(name, m_uniformSlots.size() - 1);
 
         if (location == -1)
             err() << "Uniform " << std::quoted(name) << " not found in shader" << std::endl;
 
-        return location;
+        return m_uniformSlots.size() - 1;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformSlot& Shader::stageUniform(UniformHandle handle)
+{
+    assert(handle.m_slot < m_uniformSlots.size() && "Shader::setUniform Handle belongs to another shader");
+
+    UniformSlot& slot = m_uniformSlots[handle.m_slot];
+
+    if (!slot.staged)
+    {
+        slot.staged = true;
+        m_stagedUniforms.push_back(handle.m_slot);
     }
+
+    return slot;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::uploadStagedUniforms() const
+{
+    for (const std::size_t index : m_stagedUniforms)
+    {
+        UniformSlot& slot = m_uniformSlots[index];
+
+        // Skip values that were overwritten by name in the meantime
+        if (!slot.staged)
+            continue;
+
+        slot.staged = false;
+
+        const GLint  location = slot.location;
+        const float* f        = slot.floats.data();
+        const int*   i        = slot.ints.data();
+
+        switch (slot.type)
+        {
+            // clang-format off
+            case UniformSlot::Type::Float1: glCheck(GLEXT_glUniform1f(location, f[0]));                   break;
+            case UniformSlot::Type::Float2: glCheck(GLEXT_glUniform2f(location, f[0], f[1]));             break;
+            case UniformSlot::Type::Float3: glCheck(GLEXT_glUniform3f(location, f[0], f[1], f[2]));       break;
+            case UniformSlot::Type::Float4: glCheck(GLEXT_glUniform4f(location, f[0], f[1], f[2], f[3])); break;
+            case UniformSlot::Type::Int1:   glCheck(GLEXT_glUniform1i(location, i[0]));                   break;
+            case UniformSlot::Type::Int2:   glCheck(GLEXT_glUniform2i(location, i[0], i[1]));             break;
+            case UniformSlot::Type::Int3:   glCheck(GLEXT_glUniform3i(location, i[0], i[1], i[2]));       break;
+            case UniformSlot::Type::Int4:   glCheck(GLEXT_glUniform4i(location, i[0], i[1], i[2], i[3])); break;
+            case UniformSlot::Type::Mat3:   glCheck(GLEXT_glUniformMatrix3fv(location, 1, GL_FALSE, f));  break;
+            case UniformSlot::Type::Mat4:   glCheck(GLEXT_glUniformMatrix4fv(location, 1, GL_FALSE, f));  break;
+            // clang-format on
+        }
+    }
+
+    m_stagedUniforms.clear();
 }
 
 } // namespace sf
@@ -1167,6 +1720,103 @@ void Shader::setUniformArray(const std::string& /* name */, const Glsl::Mat4* /*
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlock(const std::string& /* name */, const UniformBuffer& /* buffer */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Shader::UniformHandle> Shader::getUniformHandle(const std::string& /* name */)
+{
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, float)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec2&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec2&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, bool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec2&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat3& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat4& /* matrix */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -1194,6 +1844,26 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setProgramCacheDirectory(const std::filesystem::path& /* directory */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getProgramCacheDirectory()
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::ProgramCacheStatistics Shader::getProgramCacheStatistics()
+{
+    return {};
+}
+
+
 ////////////////////////////////////////////////////////////
 Shader::Shader(unsigned int shaderProgram) : m_shaderProgram(shaderProgram)
 {
@@ -1214,6 +1884,12 @@ void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
@@ -30,6 +30,7 @@
 #include <SFML/Graphics/Texture.hpp>
 
 #include <algorithm>
+#include <utility>
 
 #include <cassert>
 #include <cstddef>
@@ -75,8 +76,8 @@ const Texture* Shape::getTexture() const
 ////////////////////////////////////////////////////////////
 void Shape::setTextureRect(const IntRect& rect)
 {
-    m_textureRect = rect;
-    updateTexCoords();
+    m_textureRect         = rect;
+    m_texCoordsNeedUpdate = true;
 }
 
 
@@ -90,8 +91,8 @@ const IntRect& Shape::getTextureRect() const
 ////////////////////////////////////////////////////////////
 void Shape::setFillColor(const Color& color)
 {
-    m_fillColor = color;
-    updateFillColors();
+    m_fillColor            = color;
+    m_fillColorsNeedUpdate = true;
 }
 
 
@@ -105,8 +106,8 @@ const Color& Shape::getFillColor() const
 ////////////////////////////////////////////////////////////
 void Shape::setOutlineColor(const Color& color)
 {
-    m_outlineColor = color;
-    updateOutlineColors();
+    m_outlineColor            = color;
+    m_outlineColorsNeedUpdate = true;
 }
 
 
@@ -120,8 +121,8 @@ const Color& Shape::getOutlineColor() const
 ////////////////////////////////////////////////////////////
 void Shape::setOutlineThickness(float thickness)
 {
-    m_outlineThickness = thickness;
-    update(); // recompute everything because the whole shape must be offset
+    m_outlineThickness  = thickness;
+    m_outlineNeedUpdate = true;
 }
 
 
@@ -185,6 +186,7 @@ Vector2f Shape::getGeometricCenter() const
 ////////////////////////////////////////////////////////////
 FloatRect Shape::getLocalBounds() const
 {
+    ensureGeometryUpdate();
     return m_bounds;
 }
 
@@ -199,43 +201,28 @@ FloatRect Shape::getGlobalBounds() const
 ////////////////////////////////////////////////////////////
 void Shape::update()
 {
-    // Get the total number of points of the shape
-    const std::size_t count = getPointCount();
-    if (count < 3)
-    {
-        m_vertices.resize(0);
-        m_outlineVertices.resize(0);
-        return;
-    }
-
-    m_vertices.resize(count + 2); // + 2 for center and repeated first point
-
-    // Position
-    for (std::size_t i = 0; i < count; ++i)
-        m_vertices[i + 1].position = getPoint(i);
-    m_vertices[count + 1].position = m_vertices[1].position;
-
-    // Update the bounding rectangle
-    m_vertices[0]  = m_vertices[1]; // so that the result of getBounds() is correct
-    m_insideBounds = m_vertices.getBounds();
-
-    // Compute the center and make it the first vertex
-    m_vertices[0].position = m_insideBounds.getCenter();
-
-    // Color
-    updateFillColors();
+    m_pointsNeedUpdate = true;
+    m_pointsScaled     = false;
+}
 
-    // Texture coordinates
-    updateTexCoords();
 
-    // Outline
-    updateOutline();
+////////////////////////////////////////////////////////////
+void Shape::updateScaled()
+{
+    // Points that already need a full update stay that way
+    if (!m_pointsNeedUpdate)
+    {
+        m_pointsNeedUpdate = true;
+        m_pointsScaled     = true;
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shape::draw(RenderTarget& target, RenderStates states) const
 {
+    ensureGeometryUpdate();
+
     states.transform *= getTransform();
     states.coordinateType = CoordinateType::Pixels;
 
@@ -253,16 +240,96 @@ void Shape::draw(RenderTarget& target, RenderStates states) const
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateFillColors()
+std::optional<FloatRect> Shape::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::ensureGeometryUpdate() const
+{
+    // Rebuild only the components that changed; each step flags the ones that depend on it
+    if (m_pointsNeedUpdate)
+        updatePoints();
+
+    if (m_fillColorsNeedUpdate)
+        updateFillColors();
+
+    if (m_texCoordsNeedUpdate)
+        updateTexCoords();
+
+    if (m_outlineNeedUpdate)
+        updateOutline();
+
+    if (m_outlineColorsNeedUpdate)
+        updateOutlineColors();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updatePoints() const
+{
+    m_pointsNeedUpdate = false;
+    bool scaled        = std::exchange(m_pointsScaled, false);
+
+    // Get the total number of points of the shape
+    const std::size_t count = getPointCount();
+    if (count < 3)
+    {
+        m_vertices.resize(0);
+        m_outlineVertices.resize(0);
+        m_texCoordsNeedUpdate = false;
+        m_outlineNeedUpdate   = false;
+        m_outlineScaled       = false;
+        return;
+    }
+
+    // New vertices need their color, the existing ones keep it
+    if (m_vertices.getVertexCount() != count + 2)
+    {
+        m_vertices.resize(count + 2); // + 2 for center and repeated first point
+        m_fillColorsNeedUpdate = true;
+        scaled                 = false;
+    }
+
+    // Position
+    for (std::size_t i = 0; i < count; ++i)
+        m_vertices[i + 1].position = getPoint(i);
+    m_vertices[count + 1].position = m_vertices[1].position;
+
+    // Update the bounding rectangle
+    m_vertices[0].position = m_vertices[1].position; // so that the result of getBounds() is correct
+    m_insideBounds         = m_vertices.getBounds();
+
+    // Compute the center and make it the first vertex
+    m_vertices[0].position = m_insideBounds.getCenter();
+
+    // Texture coordinates and outline depend on the positions. Texture coordinates are relative
+    // to the inside bounds, so scaling doesn't change them; neither does it change the directions
+    // in which the outline is extruded, unless the outline has to be computed again anyway
+    if (!scaled)
+        m_texCoordsNeedUpdate = true;
+    m_outlineScaled     = scaled && !m_outlineNeedUpdate;
+    m_outlineNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updateFillColors() const
 {
+    m_fillColorsNeedUpdate = false;
+
     for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
         m_vertices[i].color = m_fillColor;
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateTexCoords()
+void Shape::updateTexCoords() const
 {
+    m_texCoordsNeedUpdate = false;
+
     const FloatRect convertedTextureRect(m_textureRect);
 
     for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
@@ -280,8 +347,18 @@ void Shape::updateTexCoords()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutline()
+void Shape::updateOutline() const
 {
+    m_outlineNeedUpdate = false;
+    const bool scaled   = std::exchange(m_outlineScaled, false);
+
+    // Return if there is no shape
+    if (m_vertices.getVertexCount() == 0)
+    {
+        m_outlineVertices.clear();
+        return;
+    }
+
     // Return if there is no outline
     if (m_outlineThickness == 0.f)
     {
@@ -290,8 +367,27 @@ void Shape::updateOutline()
         return;
     }
 
+    // If the shape was only scaled, keep the extrusion of each point and move it along with the point
     const std::size_t count = m_vertices.getVertexCount() - 2;
-    m_outlineVertices.resize((count + 1) * 2);
+    if (scaled && (m_outlineVertices.getVertexCount() == (count + 1) * 2))
+    {
+        for (std::size_t i = 0; i <= count; ++i)
+        {
+            const Vector2f extrusion = m_outlineVertices[i * 2 + 1].position - m_outlineVertices[i * 2].position;
+            m_outlineVertices[i * 2 + 0].position = m_vertices[i + 1].position;
+            m_outlineVertices[i * 2 + 1].position = m_vertices[i + 1].position + extrusion;
+        }
+
+        m_bounds = m_outlineVertices.getBounds();
+        return;
+    }
+
+    // New vertices need their color, the existing ones keep it
+    if (m_outlineVertices.getVertexCount() != (count + 1) * 2)
+    {
+        m_outlineVertices.resize((count + 1) * 2);
+        m_outlineColorsNeedUpdate = true;
+    }
 
     for (std::size_t i = 0; i < count; ++i)
     {
@@ -326,17 +422,16 @@ void Shape::updateOutline()
     m_outlineVertices[count * 2 + 0].position = m_outlineVertices[0].position;
     m_outlineVertices[count * 2 + 1].position = m_outlineVertices[1].position;
 
-    // Update outline colors
-    updateOutlineColors();
-
     // Update the shape's bounds
     m_bounds = m_outlineVertices.getBounds();
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutlineColors()
+void Shape::updateOutlineColors() const
 {
+    m_outlineColorsNeedUpdate = false;
+
     for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
         m_outlineVertices[i].color = m_outlineColor;
 }
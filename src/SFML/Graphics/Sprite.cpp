@@ -135,6 +135,13 @@ void Sprite::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> Sprite::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Sprite::updatePositions()
 {
@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+
+#include <array>
+
+#include <cassert>
+#include <cstdlib>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SpriteBatchImpl
+{
+// Check whether two render states can be drawn with a single draw call
+// The transform is ignored since vertices are transformed on the CPU
+bool canMerge(const sf::RenderStates& left, const sf::RenderStates& right)
+{
+    return (left.texture == right.texture) && (left.shader == right.shader) &&
+           (left.coordinateType == right.coordinateType) && (left.blendMode == right.blendMode) &&
+           (left.stencilMode == right.stencilMode);
+}
+} // namespace SpriteBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(FlushPolicy policy) : m_flushPolicy(policy)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setFlushPolicy(FlushPolicy policy)
+{
+    m_flushPolicy = policy;
+}
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::FlushPolicy SpriteBatch::getFlushPolicy() const
+{
+    return m_flushPolicy;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::append(const Sprite& sprite, const RenderStates& states)
+{
+    // Rebuild the sprite's geometry, the same way sf::Sprite does
+    const IntRect& textureRect = sprite.getTextureRect();
+    const auto     width       = static_cast<float>(std::abs(textureRect.width));
+    const auto     height      = static_cast<float>(std::abs(textureRect.height));
+
+    const FloatRect convertedTextureRect(textureRect);
+
+    const float left   = convertedTextureRect.left;
+    const float right  = left + convertedTextureRect.width;
+    const float top    = convertedTextureRect.top;
+    const float bottom = top + convertedTextureRect.height;
+
+    const Color& color = sprite.getColor();
+
+    const std::array<Vertex, 4> quad = {Vertex{{0, 0}, color, {left, top}},
+                                        Vertex{{0, height}, color, {left, bottom}},
+                                        Vertex{{width, 0}, color, {right, top}},
+                                        Vertex{{width, height}, color, {right, bottom}}};
+
+    RenderStates spriteStates = states;
+    spriteStates.transform *= sprite.getTransform();
+    spriteStates.texture        = &sprite.getTexture();
+    spriteStates.coordinateType = CoordinateType::Pixels;
+
+    append(quad.data(), spriteStates);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::append(const Vertex* quad, const RenderStates& states)
+{
+    assert(quad && "Quad must not be null");
+
+    std::vector<Vertex>& vertices = findBatch(states);
+
+    // Pre-transform the vertices
+    std::array<Vertex, 4> transformed{quad[0], quad[1], quad[2], quad[3]};
+    states.transform.transformVertices(transformed.data(), transformed.size());
+
+    // Split the quad into 2 triangles, so that several quads can be drawn at once
+    vertices.push_back(transformed[0]);
+    vertices.push_back(transformed[1]);
+    vertices.push_back(transformed[2]);
+    vertices.push_back(transformed[2]);
+    vertices.push_back(transformed[1]);
+    vertices.push_back(transformed[3]);
+
+    ++m_quadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    // Keep the batches (and their memory) around for the next frame
+    for (std::size_t i = 0; i < m_batchCount; ++i)
+        m_batches[i].vertices.clear();
+
+    m_batchCount = 0;
+    m_quadCount  = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getQuadCount() const
+{
+    return m_quadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getBatchCount() const
+{
+    return m_batchCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    for (std::size_t i = 0; i < m_batchCount; ++i)
+    {
+        const Batch& batch = m_batches[i];
+
+        RenderStates batchStates = batch.states;
+        batchStates.transform    = states.transform;
+
+        target.draw(batch.vertices.data(), batch.vertices.size(), PrimitiveType::Triangles, batchStates);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Vertex>& SpriteBatch::findBatch(const RenderStates& states)
+{
+    using SpriteBatchImpl::canMerge;
+
+    // Try to add the quad to an existing batch
+    if (m_batchCount > 0)
+    {
+        if (m_flushPolicy == FlushPolicy::ByState)
+        {
+            // Most recent batches are the most likely to match
+            for (std::size_t i = m_batchCount; i > 0; --i)
+            {
+                if (canMerge(m_batches[i - 1].states, states))
+                    return m_batches[i - 1].vertices;
+            }
+        }
+        else if (canMerge(m_batches[m_batchCount - 1].states, states))
+        {
+            return m_batches[m_batchCount - 1].vertices;
+        }
+    }
+
+    // Start a new batch, reusing a previously allocated one if possible
+    if (m_batchCount == m_batches.size())
+        m_batches.emplace_back();
+
+    Batch& batch           = m_batches[m_batchCount++];
+    batch.states           = states;
+    batch.states.transform = Transform::Identity;
+
+    return batch.vertices;
+}
+
+} // namespace sf
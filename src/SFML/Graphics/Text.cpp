@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
@@ -60,15 +61,20 @@ void addLine(sf::VertexArray& vertices,
     vertices.append({{lineLength + outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
 }
 
-// Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+// Add a glyph quad to the vertex array, scaling the glyph from the size it was rasterized at
+// The quad extends padding texels of the glyph's texture beyond its bounds on each side
+void addGlyphQuad(sf::VertexArray& vertices,
+                  sf::Vector2f     position,
+                  const sf::Color& color,
+                  const sf::Glyph& glyph,
+                  float            italicShear,
+                  float            scale   = 1.f,
+                  float            padding = 1.f)
 {
-    const float padding = 1.0;
-
-    const float left   = glyph.bounds.left - padding;
-    const float top    = glyph.bounds.top - padding;
-    const float right  = glyph.bounds.left + glyph.bounds.width + padding;
-    const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+    const float left   = (glyph.bounds.left - padding) * scale;
+    const float top    = (glyph.bounds.top - padding) * scale;
+    const float right  = (glyph.bounds.left + glyph.bounds.width + padding) * scale;
+    const float bottom = (glyph.bounds.top + glyph.bounds.height + padding) * scale;
 
     const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
     const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
@@ -101,8 +107,14 @@ void Text::setString(const String& string)
 {
     if (m_string != string)
     {
-        m_string             = string;
-        m_geometryNeedUpdate = true;
+        // Appended characters can be laid out without updating the whole geometry
+        const bool isAppended = (string.getSize() > m_string.getSize()) &&
+                                std::equal(m_string.begin(), m_string.end(), string.begin());
+
+        m_string = string;
+
+        if (!isAppended)
+            m_geometryNeedUpdate = true;
     }
 }
 
@@ -209,6 +221,17 @@ void Text::setOutlineThickness(float thickness)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::setRenderMode(RenderMode mode)
+{
+    if (mode != m_renderMode)
+    {
+        m_renderMode         = mode;
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 const String& Text::getString() const
 {
@@ -272,15 +295,37 @@ float Text::getOutlineThickness() const
 }
 
 
+////////////////////////////////////////////////////////////
+Text::RenderMode Text::getRenderMode() const
+{
+    return m_renderMode;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2f Text::findCharacterPos(std::size_t index) const
 {
     // Adjust the index if it's out of range
     index = std::min(index, m_string.getSize());
 
+    // Distance field glyphs are rasterized at a single size and scaled to the character size
+    const bool         isBold        = m_style & Bold;
+    const bool         distanceField = isDistanceFieldRendered();
+    const unsigned int glyphSize     = distanceField ? m_font->getDistanceFieldSize() : m_characterSize;
+    const float        scale         = static_cast<float>(m_characterSize) / static_cast<float>(glyphSize);
+    const auto         getGlyph      = [&](std::uint32_t codePoint) -> const Glyph&
+    {
+        return distanceField ? m_font->getDistanceFieldGlyph(codePoint, isBold)
+                             : m_font->getGlyph(codePoint, m_characterSize, isBold);
+    };
+    const auto         getKerning    = [&](std::uint32_t first, std::uint32_t second)
+    {
+        return distanceField ? m_font->getDistanceFieldKerning(first, second, isBold)
+                             : m_font->getKerning(first, second, m_characterSize, isBold);
+    };
+
     // Precompute the variables needed by the algorithm
-    const bool  isBold          = m_style & Bold;
-    float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+    float       whitespaceWidth = getGlyph(U' ').advance * scale;
     const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
@@ -293,7 +338,7 @@ Vector2f Text::findCharacterPos(std::size_t index) const
         const std::uint32_t curChar = m_string[i];
 
         // Apply the kerning offset
-        position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+        position.x += getKerning(prevChar, curChar) * scale;
         prevChar = curChar;
 
         // Handle special characters
@@ -312,7 +357,7 @@ Vector2f Text::findCharacterPos(std::size_t index) const
         }
 
         // For regular characters, add the advance offset of the glyph
-        position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance + letterSpacing;
+        position.x += getGlyph(curChar).advance * scale + letterSpacing;
     }
 
     // Transform the position to global coordinates
@@ -344,9 +389,41 @@ void Text::draw(RenderTarget& target, RenderStates states) const
     ensureGeometryUpdate();
 
     states.transform *= getTransform();
-    states.texture        = &m_font->getTexture(m_characterSize);
     states.coordinateType = CoordinateType::Pixels;
 
+    if (isDistanceFieldRendered())
+    {
+        states.texture = &m_font->getDistanceFieldTexture();
+
+        // Custom shaders are given the distance fields as is
+        if (!states.shader)
+        {
+            Shader* shader = m_font->getDistanceFieldShader();
+            states.shader  = shader;
+
+            // In distance field mode, the outline geometry only contains the underline and strike through lines,
+            // the outline of the glyphs is drawn by the shader along with their fill
+            if (m_outlineThickness != 0)
+            {
+                shader->setUniform("outlineThickness", 0.f);
+                target.draw(m_outlineVertices, states);
+            }
+
+            // The shader expects the outline thickness as a fraction of the range of the distance field
+            const auto  spread    = static_cast<float>(m_font->getDistanceFieldSpread());
+            const float thickness = std::abs(m_outlineThickness) * static_cast<float>(m_font->getDistanceFieldSize()) /
+                                    static_cast<float>(m_characterSize);
+            shader->setUniform("outlineThickness", std::min(thickness, spread) / (2.f * spread));
+            shader->setUniform("outlineColor", Glsl::Vec4(m_outlineColor));
+            target.draw(m_vertices, states);
+            return;
+        }
+    }
+    else
+    {
+        states.texture = &m_font->getTexture(m_characterSize);
+    }
+
     // Only draw the outline if there is something to draw
     if (m_outlineThickness != 0)
         target.draw(m_outlineVertices, states);
@@ -355,30 +432,79 @@ void Text::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> Text::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Text::isDistanceFieldRendered() const
+{
+    return (m_renderMode == RenderMode::DistanceField) && m_font->getDistanceFieldShader();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
-    // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
+    // Distance field glyphs are rasterized at a single size and scaled to the character size
+    const bool         isBold        = m_style & Bold;
+    const bool         distanceField = isDistanceFieldRendered();
+    const unsigned int glyphSize     = distanceField ? m_font->getDistanceFieldSize() : m_characterSize;
+    const float        scale         = static_cast<float>(m_characterSize) / static_cast<float>(glyphSize);
+    const float        padding       = distanceField ? static_cast<float>(m_font->getDistanceFieldSpread()) : 1.f;
+    const auto         getGlyph      = [&](std::uint32_t codePoint) -> const Glyph&
+    {
+        return distanceField ? m_font->getDistanceFieldGlyph(codePoint, isBold)
+                             : m_font->getGlyph(codePoint, m_characterSize, isBold);
+    };
+    const auto         getKerning    = [&](std::uint32_t first, std::uint32_t second)
+    {
+        return distanceField ? m_font->getDistanceFieldKerning(first, second, isBold)
+                             : m_font->getKerning(first, second, m_characterSize, isBold);
+    };
+
+    // Do nothing, if geometry has not changed, no character was appended and the font texture has not changed
+    const Font::Page& page       = distanceField ? m_font->loadDistanceFieldPage() : m_font->loadPage(m_characterSize);
+    const bool        fullUpdate = m_geometryNeedUpdate || (page.texture.m_cacheId != m_fontTextureId);
+    if (!fullUpdate && (m_layout.length == m_string.getSize()))
         return;
 
-    // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
-
     // Mark geometry as updated
     m_geometryNeedUpdate = false;
 
-    // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
-    m_bounds = FloatRect();
+    if (fullUpdate)
+    {
+        // Clear the previous geometry
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_bounds = FloatRect();
+
+        // Start the layout from the beginning of the string
+        m_layout          = Layout();
+        m_layout.position = Vector2f(0.f, static_cast<float>(m_characterSize));
+        m_layout.min      = Vector2f(static_cast<float>(m_characterSize), static_cast<float>(m_characterSize));
+    }
+    else
+    {
+        // Remove the lines closing the text, they are added again after the appended characters
+        m_vertices.resize(m_layout.vertexCount);
+        m_outlineVertices.resize(m_layout.outlineVertexCount);
+    }
 
     // No text: nothing to draw
     if (m_string.isEmpty())
+    {
+        m_fontTextureId = page.texture.m_cacheId;
         return;
+    }
+
+    // Loading the glyphs of the text may evict other glyphs from the font's atlas
+    const std::size_t evictionCount = page.evictionCount;
 
     // Compute values related to the text style
-    const bool  isBold             = m_style & Bold;
     const bool  isUnderlined       = m_style & Underlined;
     const bool  isStrikeThrough    = m_style & StrikeThrough;
     const float italicShear        = (m_style & Italic) ? degrees(12).asRadians() : 0.f;
@@ -388,30 +514,32 @@ void Text::ensureGeometryUpdate() const
     // Compute the location of the strike through dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
     // We reuse the underline thickness as the thickness of the strike through as well
-    const float strikeThroughOffset = m_font->getGlyph(U'x', m_characterSize, isBold).bounds.getCenter().y;
+    const float strikeThroughOffset = getGlyph(U'x').bounds.getCenter().y * scale;
 
     // Precompute the variables needed by the algorithm
-    float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+    float       whitespaceWidth = getGlyph(U' ').advance * scale;
     const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
-    float       x           = 0.f;
-    auto        y           = static_cast<float>(m_characterSize);
-
-    // Create one quad for each character
-    auto          minX     = static_cast<float>(m_characterSize);
-    auto          minY     = static_cast<float>(m_characterSize);
-    float         maxX     = 0.f;
-    float         maxY     = 0.f;
-    std::uint32_t prevChar = 0;
-    for (const std::uint32_t curChar : m_string)
+    float       x           = m_layout.position.x;
+    float       y           = m_layout.position.y;
+
+    // Create one quad for each character that isn't laid out yet
+    float         minX     = m_layout.min.x;
+    float         minY     = m_layout.min.y;
+    float         maxX     = m_layout.max.x;
+    float         maxY     = m_layout.max.y;
+    std::uint32_t prevChar = m_layout.prevChar;
+    for (std::size_t i = m_layout.length; i < m_string.getSize(); ++i)
     {
+        const std::uint32_t curChar = m_string[i];
+
         // Skip the \r char to avoid weird graphical issues
         if (curChar == U'\r')
             continue;
 
         // Apply the kerning offset
-        x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+        x += getKerning(prevChar, curChar) * scale;
 
         // If we're using the underlined style and there's a new line, draw a line
         if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
@@ -462,8 +590,8 @@ void Text::ensureGeometryUpdate() const
             continue;
         }
 
-        // Apply the outline
-        if (m_outlineThickness != 0)
+        // Apply the outline, which is drawn by the shader in distance field mode
+        if ((m_outlineThickness != 0) && !distanceField)
         {
             const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
 
@@ -472,16 +600,16 @@ void Text::ensureGeometryUpdate() const
         }
 
         // Extract the current glyph's description
-        const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
+        const Glyph& glyph = getGlyph(curChar);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear, scale, padding);
 
         // Update the current bounds
-        const float left   = glyph.bounds.left;
-        const float top    = glyph.bounds.top;
-        const float right  = glyph.bounds.left + glyph.bounds.width;
-        const float bottom = glyph.bounds.top + glyph.bounds.height;
+        const float left   = glyph.bounds.left * scale;
+        const float top    = glyph.bounds.top * scale;
+        const float right  = (glyph.bounds.left + glyph.bounds.width) * scale;
+        const float bottom = (glyph.bounds.top + glyph.bounds.height) * scale;
 
         minX = std::min(minX, x + left - italicShear * bottom);
         maxX = std::max(maxX, x + right - italicShear * top);
@@ -489,7 +617,33 @@ void Text::ensureGeometryUpdate() const
         maxY = std::max(maxY, y + bottom);
 
         // Advance to the next character
-        x += glyph.advance + letterSpacing;
+        x += glyph.advance * scale + letterSpacing;
+    }
+
+    // Save the state of the layout, so that appended characters can be laid out from there
+    m_layout.length             = m_string.getSize();
+    m_layout.position           = Vector2f(x, y);
+    m_layout.min                = Vector2f(minX, minY);
+    m_layout.max                = Vector2f(maxX, maxY);
+    m_layout.prevChar           = prevChar;
+    m_layout.vertexCount        = m_vertices.getVertexCount();
+    m_layout.outlineVertexCount = m_outlineVertices.getVertexCount();
+
+    // Save the current fonts texture id, now that the glyphs of the text are loaded
+    m_fontTextureId = page.texture.m_cacheId;
+
+    // If other glyphs of the text were evicted meanwhile, their quads have to be updated again.
+    // Retrying only makes sense while each pass evicts fewer glyphs than the previous one: when
+    // the text needs more glyphs than the atlas can hold, every pass evicts as many of them
+    const std::size_t passEvictionCount = page.evictionCount - evictionCount;
+    if ((passEvictionCount > 0) && ((m_retryEvictionCount == 0) || (passEvictionCount < m_retryEvictionCount)))
+    {
+        m_geometryNeedUpdate = true;
+        m_retryEvictionCount = passEvictionCount;
+    }
+    else
+    {
+        m_retryEvictionCount = 0;
     }
 
     // If we're using outline, update the current bounds
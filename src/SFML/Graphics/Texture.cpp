@@ -28,6 +28,7 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PixelOperations.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
 
@@ -77,6 +78,7 @@ GlResource(copy),
 m_isSmooth(copy.m_isSmooth),
 m_sRgb(copy.m_sRgb),
 m_isRepeated(copy.m_isRepeated),
+m_alphaOnly(copy.m_alphaOnly),
 m_cacheId(TextureImpl::getUniqueId())
 {
     if (copy.m_texture)
@@ -115,6 +117,7 @@ m_isSmooth(std::exchange(right.m_isSmooth, false)),
 m_sRgb(std::exchange(right.m_sRgb, false)),
 m_isRepeated(std::exchange(right.m_isRepeated, false)),
 m_fboAttachment(std::exchange(right.m_fboAttachment, false)),
+m_alphaOnly(std::exchange(right.m_alphaOnly, false)),
 m_cacheId(std::exchange(right.m_cacheId, 0))
 {
 }
@@ -145,6 +148,7 @@ Texture& Texture::operator=(Texture&& right) noexcept
     m_sRgb          = std::exchange(right.m_sRgb, false);
     m_isRepeated    = std::exchange(right.m_isRepeated, false);
     m_fboAttachment = std::exchange(right.m_fboAttachment, false);
+    m_alphaOnly     = std::exchange(right.m_alphaOnly, false);
     m_cacheId       = std::exchange(right.m_cacheId, 0);
     return *this;
 }
@@ -241,15 +245,45 @@ bool Texture::create(const Vector2u& size)
 
     // Initialize the texture
     glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
-    glCheck(glTexImage2D(GL_TEXTURE_2D,
-                         0,
-                         (m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
-                         static_cast<GLsizei>(m_actualSize.x),
-                         static_cast<GLsizei>(m_actualSize.y),
-                         0,
-                         GL_RGBA,
-                         GL_UNSIGNED_BYTE,
-                         nullptr));
+
+#ifndef SFML_OPENGL_ES
+    if (m_alphaOnly)
+    {
+        glCheck(glTexImage2D(GL_TEXTURE_2D,
+                             0,
+                             GL_ALPHA8,
+                             static_cast<GLsizei>(m_actualSize.x),
+                             static_cast<GLsizei>(m_actualSize.y),
+                             0,
+                             GL_ALPHA,
+                             GL_UNSIGNED_BYTE,
+                             nullptr));
+
+        // Let shaders see white pixels, like the fixed function pipeline does
+        static const bool textureSwizzle = GLEXT_texture_swizzle ||
+                                           Context::isExtensionAvailable("GL_ARB_texture_swizzle") ||
+                                           Context::isExtensionAvailable("GL_EXT_texture_swizzle");
+
+        if (textureSwizzle)
+        {
+            const std::array<GLint, 4> swizzle = {GL_ONE, GL_ONE, GL_ONE, GL_ALPHA};
+            glCheck(glTexParameteriv(GL_TEXTURE_2D, GLEXT_GL_TEXTURE_SWIZZLE_RGBA, swizzle.data()));
+        }
+    }
+    else
+#endif
+    {
+        glCheck(glTexImage2D(GL_TEXTURE_2D,
+                             0,
+                             (m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                             static_cast<GLsizei>(m_actualSize.x),
+                             static_cast<GLsizei>(m_actualSize.y),
+                             0,
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             nullptr));
+    }
+
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrapParam));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureWrapParam));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
@@ -292,6 +326,20 @@ bool Texture::loadFromStream(InputStream& stream, const IntRect& area)
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::createAlpha(const Vector2u& size)
+{
+#ifndef SFML_OPENGL_ES
+    m_alphaOnly = true;
+#else
+    // OpenGL ES can neither read back nor copy alpha textures, fall back to RGBA
+    m_alphaOnly = false;
+#endif
+
+    return create(size);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Texture::loadFromImage(const Image& image, const IntRect& area)
 {
@@ -345,10 +393,6 @@ bool Texture::loadFromImage(const Image& image, const IntRect& area)
             glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
             m_hasMipmap = false;
 
-            // Force an OpenGL flush, so that the texture will appear updated
-            // in all contexts immediately (solves problems in multi-threaded apps)
-            glCheck(glFlush());
-
             return true;
         }
         else
@@ -407,16 +451,14 @@ Image Texture::copyToImage() const
         if (m_pixelsFlipped)
         {
             // Flip the texture vertically
-            const auto stride             = static_cast<std::ptrdiff_t>(m_size.x * 4);
-            auto       currentRowIterator = pixels.begin();
-            auto       nextRowIterator    = pixels.begin() + stride;
-            auto       reverseRowIterator = pixels.begin() + (stride * static_cast<std::ptrdiff_t>(m_size.y - 1));
+            const std::size_t stride     = m_size.x * 4;
+            std::uint8_t*     currentRow = pixels.data();
+            std::uint8_t*     reverseRow = pixels.data() + stride * (m_size.y - 1);
             for (unsigned int i = 0; i < m_size.y / 2; ++i)
             {
-                std::swap_ranges(currentRowIterator, nextRowIterator, reverseRowIterator);
-                currentRowIterator = nextRowIterator;
-                nextRowIterator += stride;
-                reverseRowIterator -= stride;
+                priv::swapPixels(currentRow, reverseRow, stride);
+                currentRow += stride;
+                reverseRow -= stride;
             }
         }
     }
@@ -459,6 +501,10 @@ Image Texture::copyToImage() const
         }
     }
 
+    // Alpha-only textures are read back as white pixels, like they are rendered
+    if (m_alphaOnly)
+        priv::whitenPixels(pixels.data(), pixels.size() / 4);
+
 #endif // SFML_OPENGL_ES
 
     return {m_size, pixels.data()};
@@ -501,10 +547,45 @@ void Texture::update(const std::uint8_t* pixels, const Vector2u& size, const Vec
         m_hasMipmap     = false;
         m_pixelsFlipped = false;
         m_cacheId       = TextureImpl::getUniqueId();
+    }
+}
+
 
-        // Force an OpenGL flush, so that the texture data will appear updated
-        // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
+////////////////////////////////////////////////////////////
+void Texture::updateAlpha(const std::uint8_t* alpha, const Vector2u& size, const Vector2u& dest)
+{
+    assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+    assert(m_alphaOnly && "Texture::updateAlpha Texture must be alpha-only");
+
+    if (alpha && m_texture)
+    {
+        const TransientContextLock lock;
+
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        // Rows of alpha values are tightly packed
+        GLint unpackAlignment = 0;
+        glCheck(glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment));
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+        // Copy alpha values from the given array to the texture
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                                0,
+                                static_cast<GLint>(dest.x),
+                                static_cast<GLint>(dest.y),
+                                static_cast<GLsizei>(size.x),
+                                static_cast<GLsizei>(size.y),
+                                GL_ALPHA,
+                                GL_UNSIGNED_BYTE,
+                                alpha));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment));
+        m_hasMipmap     = false;
+        m_pixelsFlipped = false;
+        m_cacheId       = TextureImpl::getUniqueId();
     }
 }
 
@@ -535,7 +616,8 @@ void Texture::update(const Texture& texture, const Vector2u& dest)
         priv::ensureExtensionsInit();
     }
 
-    if (GLEXT_framebuffer_object && GLEXT_framebuffer_blit)
+    // Alpha-only textures can't be attached to a frame buffer object
+    if (GLEXT_framebuffer_object && GLEXT_framebuffer_blit && !m_alphaOnly && !texture.m_alphaOnly)
     {
         const TransientContextLock lock;
 
@@ -627,10 +709,6 @@ void Texture::update(const Texture& texture, const Vector2u& dest)
         m_pixelsFlipped = false;
         m_cacheId       = TextureImpl::getUniqueId();
 
-        // Force an OpenGL flush, so that the texture data will appear updated
-        // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
-
         return;
     }
 
@@ -689,10 +767,6 @@ void Texture::update(const Window& window, const Vector2u& dest)
         m_hasMipmap     = false;
         m_pixelsFlipped = true;
         m_cacheId       = TextureImpl::getUniqueId();
-
-        // Force an OpenGL flush, so that the texture will appear updated
-        // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
     }
 }
 
@@ -849,6 +923,16 @@ void Texture::invalidateMipmap()
 }
 
 
+////////////////////////////////////////////////////////////
+void Texture::invalidateContents()
+{
+    invalidateMipmap();
+
+    m_pixelsFlipped = false;
+    m_cacheId       = TextureImpl::getUniqueId();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::bind(const Texture* texture, CoordinateType coordinateType)
 {
@@ -957,6 +1041,7 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
     std::swap(m_fboAttachment, right.m_fboAttachment);
     std::swap(m_hasMipmap, right.m_hasMipmap);
+    std::swap(m_alphaOnly, right.m_alphaOnly);
 
     m_cacheId       = TextureImpl::getUniqueId();
     right.m_cacheId = TextureImpl::getUniqueId();
@@ -0,0 +1,435 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/PixelOperations.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/Graphics/TextureStreamer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <ostream>
+#include <vector>
+
+#include <cassert>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureStreamer::Impl
+{
+    struct UploadBuffer
+    {
+        unsigned int buffer{};   //!< Pixel unpack buffer object
+        std::size_t  capacity{}; //!< Size of the buffer storage, in bytes
+        GLsync       fence{};    //!< Signaled once the GPU is done reading the buffer
+    };
+
+    struct Readback
+    {
+        unsigned int         buffer{};    //!< Pixel pack buffer object holding the texture contents
+        GLsync               fence{};     //!< Signaled once the GPU is done writing the buffer
+        Vector2u             size;        //!< Public size of the texture
+        Vector2u             actualSize;  //!< Actual size of the texture, including padding
+        bool                 flipped{};   //!< Are the texture rows stored bottom to top?
+        bool                 alphaOnly{}; //!< Does the texture only have an alpha channel?
+        std::optional<Image> image;       //!< Image copied synchronously when streaming is not available
+    };
+
+    explicit Impl(std::size_t bufferCount) : uploadBuffers(std::max(bufferCount, std::size_t{1}))
+    {
+    }
+
+    std::optional<Image> finishReadback();
+
+    std::vector<UploadBuffer> uploadBuffers;   //!< Ring of upload buffers
+    std::size_t               nextUpload{};    //!< Index of the next upload buffer to use
+    std::deque<Readback>      readbacks;       //!< Pending readbacks, oldest first
+    std::vector<unsigned int> readbackBuffers; //!< Pack buffers of completed readbacks, ready for reuse
+};
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> TextureStreamer::Impl::finishReadback()
+{
+    Readback readback = std::move(readbacks.front());
+    readbacks.pop_front();
+
+    if (readback.image)
+        return std::move(readback.image);
+
+#ifdef SFML_OPENGL_ES
+
+    return std::nullopt;
+
+#else
+
+    const TransientContextLock lock;
+
+    if (readback.fence)
+        glCheck(GLEXT_glDeleteSync(readback.fence));
+
+    std::vector<std::uint8_t> pixels(std::size_t{readback.size.x} * readback.size.y * 4);
+
+    // Mapping the buffer waits for the GPU if it is not done writing it yet
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, readback.buffer));
+
+    const void* source = nullptr;
+    glCheck(source = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY));
+
+    GLboolean result = GL_FALSE;
+    if (source)
+    {
+        // Copy the useful pixels, skipping the padding and
+        // handling the case where source pixels are flipped vertically
+        const auto*       src      = static_cast<const std::uint8_t*>(source);
+        std::uint8_t*     dst      = pixels.data();
+        const std::size_t srcPitch = std::size_t{readback.actualSize.x} * 4;
+        const std::size_t dstPitch = std::size_t{readback.size.x} * 4;
+
+        for (unsigned int i = 0; i < readback.size.y; ++i)
+        {
+            const unsigned int row = readback.flipped ? readback.size.y - 1 - i : i;
+            std::memcpy(dst, src + row * srcPitch, dstPitch);
+            dst += dstPitch;
+        }
+
+        glCheck(result = GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+    readbackBuffers.push_back(readback.buffer);
+
+    if (result != GL_TRUE)
+    {
+        err() << "Failed to read back texture, the pixel buffer object could not be mapped" << std::endl;
+        return std::nullopt;
+    }
+
+    // Alpha-only textures are read back as white pixels, like they are rendered
+    if (readback.alphaOnly)
+        priv::whitenPixels(pixels.data(), pixels.size() / 4);
+
+    return Image(readback.size, pixels.data());
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::TextureStreamer(std::size_t bufferCount) : m_impl(std::make_unique<Impl>(bufferCount))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::~TextureStreamer()
+{
+#ifndef SFML_OPENGL_ES
+
+    const TransientContextLock lock;
+
+    for (const Impl::UploadBuffer& upload : m_impl->uploadBuffers)
+    {
+        if (upload.fence)
+            glCheck(GLEXT_glDeleteSync(upload.fence));
+
+        if (upload.buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &upload.buffer));
+    }
+
+    for (const Impl::Readback& readback : m_impl->readbacks)
+    {
+        if (readback.fence)
+            glCheck(GLEXT_glDeleteSync(readback.fence));
+
+        if (readback.buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &readback.buffer));
+    }
+
+    for (const unsigned int buffer : m_impl->readbackBuffers)
+        glCheck(GLEXT_glDeleteBuffers(1, &buffer));
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::update(Texture& texture, const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest)
+{
+    assert(dest.x + size.x <= texture.m_size.x && "Destination x coordinate is outside of texture");
+    assert(dest.y + size.y <= texture.m_size.y && "Destination y coordinate is outside of texture");
+
+    if (!pixels || !texture.m_texture)
+        return;
+
+#ifndef SFML_OPENGL_ES
+
+    if (isAvailable())
+    {
+        const TransientContextLock lock;
+
+        Impl::UploadBuffer& upload = m_impl->uploadBuffers[m_impl->nextUpload];
+        m_impl->nextUpload         = (m_impl->nextUpload + 1) % m_impl->uploadBuffers.size();
+
+        if (!upload.buffer)
+            glCheck(GLEXT_glGenBuffers(1, &upload.buffer));
+
+        if (!upload.buffer)
+        {
+            err() << "Failed to stream texture update, failed to create a pixel buffer object" << std::endl;
+            texture.update(pixels, size, dest);
+            return;
+        }
+
+        const std::size_t byteCount = std::size_t{size.x} * size.y * 4;
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, upload.buffer));
+
+        // Writing to a buffer the GPU is still reading from would wait for it,
+        // so give the buffer new storage instead and let the driver release
+        // the old one once the previous upload is done
+        bool busy = upload.capacity < byteCount;
+        if (upload.fence)
+        {
+            GLenum status = 0;
+            glCheck(status = GLEXT_glClientWaitSync(upload.fence, 0, 0));
+            busy = busy || ((status != GLEXT_GL_ALREADY_SIGNALED) && (status != GLEXT_GL_CONDITION_SATISFIED));
+
+            glCheck(GLEXT_glDeleteSync(upload.fence));
+            upload.fence = nullptr;
+        }
+        else if (upload.capacity > 0)
+        {
+            // Without fences we can't tell, assume the worst
+            busy = true;
+        }
+
+        if (busy)
+        {
+            upload.capacity = std::max(upload.capacity, byteCount);
+            glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER,
+                                       static_cast<GLsizeiptrARB>(upload.capacity),
+                                       nullptr,
+                                       GLEXT_GL_STREAM_DRAW));
+        }
+
+        void* destination = nullptr;
+        glCheck(destination = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, GLEXT_GL_WRITE_ONLY));
+
+        GLboolean result = GL_FALSE;
+        if (destination)
+        {
+            std::memcpy(destination, pixels, byteCount);
+            glCheck(result = GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER));
+        }
+
+        if (result == GL_TRUE)
+        {
+            // Make sure that the current texture binding will be preserved
+            const priv::TextureSaver save;
+
+            // Copy pixels from the buffer to the texture, the GPU performs
+            // the copy asynchronously
+            glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+            glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                                    0,
+                                    static_cast<GLint>(dest.x),
+                                    static_cast<GLint>(dest.y),
+                                    static_cast<GLsizei>(size.x),
+                                    static_cast<GLsizei>(size.y),
+                                    GL_RGBA,
+                                    GL_UNSIGNED_BYTE,
+                                    nullptr));
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+            if (GLEXT_sync)
+                glCheck(upload.fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+            texture.invalidateContents();
+            return;
+        }
+
+        // The buffer contents were lost (this can happen e.g. on a video mode change),
+        // fall back to a direct update
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+        upload.capacity = 0;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    texture.update(pixels, size, dest);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::update(Texture& texture, const Image& image, const Vector2u& dest)
+{
+    update(texture, image.getPixelsPtr(), image.getSize(), dest);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::requestReadback(const Texture& texture)
+{
+    assert(texture.m_texture && "TextureStreamer::requestReadback Cannot copy empty texture");
+
+#ifndef SFML_OPENGL_ES
+
+    if (isAvailable())
+    {
+        const TransientContextLock lock;
+
+        Impl::Readback readback;
+        readback.size       = texture.m_size;
+        readback.actualSize = texture.m_actualSize;
+        readback.flipped    = texture.m_pixelsFlipped;
+        readback.alphaOnly  = texture.m_alphaOnly;
+
+        // Reuse the buffer of a completed readback if there is one
+        if (!m_impl->readbackBuffers.empty())
+        {
+            readback.buffer = m_impl->readbackBuffers.back();
+            m_impl->readbackBuffers.pop_back();
+        }
+        else
+        {
+            glCheck(GLEXT_glGenBuffers(1, &readback.buffer));
+        }
+
+        if (readback.buffer)
+        {
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, readback.buffer));
+            glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                       static_cast<GLsizeiptrARB>(std::size_t{readback.actualSize.x} *
+                                                                  readback.actualSize.y * 4),
+                                       nullptr,
+                                       GLEXT_GL_STREAM_READ));
+
+            {
+                // Make sure that the current texture binding will be preserved
+                const priv::TextureSaver save;
+
+                // Copy the texture to the buffer, the GPU performs the copy asynchronously
+                glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+                glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+            }
+
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+            if (GLEXT_sync)
+                glCheck(readback.fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+            m_impl->readbacks.push_back(std::move(readback));
+            return;
+        }
+
+        err() << "Failed to stream texture readback, failed to create a pixel buffer object" << std::endl;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    Impl::Readback readback;
+    readback.image = texture.copyToImage();
+    m_impl->readbacks.push_back(std::move(readback));
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> TextureStreamer::pollReadback()
+{
+    if (m_impl->readbacks.empty())
+        return std::nullopt;
+
+#ifndef SFML_OPENGL_ES
+
+    if (const GLsync fence = m_impl->readbacks.front().fence)
+    {
+        const TransientContextLock lock;
+
+        // Flush the pending commands so that the fence eventually gets signaled
+        GLenum status = 0;
+        glCheck(status = GLEXT_glClientWaitSync(fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 0));
+
+        if ((status != GLEXT_GL_ALREADY_SIGNALED) && (status != GLEXT_GL_CONDITION_SATISFIED))
+            return std::nullopt;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    return m_impl->finishReadback();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> TextureStreamer::waitReadback()
+{
+    if (m_impl->readbacks.empty())
+        return std::nullopt;
+
+    return m_impl->finishReadback();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getPendingReadbackCount() const
+{
+    return m_impl->readbacks.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::isAvailable()
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    static const bool available = []() -> bool
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        sf::priv::ensureExtensionsInit();
+
+        return GLEXT_vertex_buffer_object && GLEXT_pixel_buffer_object;
+    }();
+
+    return available;
+
+#endif // SFML_OPENGL_ES
+}
+
+} // namespace sf
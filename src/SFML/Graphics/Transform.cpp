@@ -26,11 +26,49 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
 #include <SFML/System/Angle.hpp>
 
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_TRANSFORM_SSE2
+#include <emmintrin.h>
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#define SFML_TRANSFORM_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// The batch functions reinterpret arrays of points as arrays of floats
+static_assert(sizeof(sf::Vector2f) == 2 * sizeof(float), "sf::Vector2f must be tightly packed");
+
+#if defined(SFML_TRANSFORM_SSE2)
+
+// Transform two points packed as (x0, y0, x1, y1), using the same operations as sf::Transform::transformPoint
+__m128 transformPair(__m128 points, __m128 column0, __m128 column1, __m128 translation)
+{
+    const __m128 x = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128 y = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, column0), _mm_mul_ps(y, column1)), translation);
+}
+
+#elif defined(SFML_TRANSFORM_NEON)
+
+// Transform two points packed as (x0, y0, x1, y1), using the same operations as sf::Transform::transformPoint
+float32x4_t transformPair(float32x4_t points, float32x4_t column0, float32x4_t column1, float32x4_t translation)
+{
+    const float32x4_t x = vtrn1q_f32(points, points);
+    const float32x4_t y = vtrn2q_f32(points, points);
+    return vaddq_f32(vaddq_f32(vmulq_f32(x, column0), vmulq_f32(y, column1)), translation);
+}
+
+#endif
+} // namespace
+
 
 namespace sf
 {
@@ -67,4 +105,107 @@ Transform& Transform::rotate(Angle angle, const Vector2f& center)
     return combine(rotation);
 }
 
+
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vector2f* points, Vector2f* output, std::size_t count) const
+{
+    std::size_t i = 0;
+
+#if defined(SFML_TRANSFORM_SSE2)
+
+    const __m128 column0     = _mm_setr_ps(m_matrix[0], m_matrix[1], m_matrix[0], m_matrix[1]);
+    const __m128 column1     = _mm_setr_ps(m_matrix[4], m_matrix[5], m_matrix[4], m_matrix[5]);
+    const __m128 translation = _mm_setr_ps(m_matrix[12], m_matrix[13], m_matrix[12], m_matrix[13]);
+
+    // Process 4 points per iteration
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 first  = _mm_loadu_ps(&points[i].x);
+        const __m128 second = _mm_loadu_ps(&points[i + 2].x);
+        _mm_storeu_ps(&output[i].x, transformPair(first, column0, column1, translation));
+        _mm_storeu_ps(&output[i + 2].x, transformPair(second, column0, column1, translation));
+    }
+
+#elif defined(SFML_TRANSFORM_NEON)
+
+    const float32x4_t xFromX  = vdupq_n_f32(m_matrix[0]);
+    const float32x4_t xFromY  = vdupq_n_f32(m_matrix[4]);
+    const float32x4_t xOffset = vdupq_n_f32(m_matrix[12]);
+    const float32x4_t yFromX  = vdupq_n_f32(m_matrix[1]);
+    const float32x4_t yFromY  = vdupq_n_f32(m_matrix[5]);
+    const float32x4_t yOffset = vdupq_n_f32(m_matrix[13]);
+
+    // Process 4 points per iteration, deinterleaving their coordinates into (x0, x1, x2, x3) and (y0, y1, y2, y3)
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4x2_t input = vld2q_f32(&points[i].x);
+        float32x4x2_t       result;
+        result.val[0] = vaddq_f32(vaddq_f32(vmulq_f32(input.val[0], xFromX), vmulq_f32(input.val[1], xFromY)), xOffset);
+        result.val[1] = vaddq_f32(vaddq_f32(vmulq_f32(input.val[0], yFromX), vmulq_f32(input.val[1], yFromY)), yOffset);
+        vst2q_f32(&output[i].x, result);
+    }
+
+#endif
+
+    // Process the remaining points
+    for (; i < count; ++i)
+        output[i] = transformPoint(points[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+void Transform::transformVertices(Vertex* vertices, std::size_t count) const
+{
+    std::size_t i = 0;
+
+    // Vertex positions are not contiguous, so they are gathered in pairs
+#if defined(SFML_TRANSFORM_SSE2)
+
+    const __m128 column0     = _mm_setr_ps(m_matrix[0], m_matrix[1], m_matrix[0], m_matrix[1]);
+    const __m128 column1     = _mm_setr_ps(m_matrix[4], m_matrix[5], m_matrix[4], m_matrix[5]);
+    const __m128 translation = _mm_setr_ps(m_matrix[12], m_matrix[13], m_matrix[12], m_matrix[13]);
+
+    // Process 4 vertices per iteration
+    for (; i + 4 <= count; i += 4)
+    {
+        for (std::size_t j = i; j < i + 4; j += 2)
+        {
+            auto* first  = reinterpret_cast<__m64*>(&vertices[j].position.x);
+            auto* second = reinterpret_cast<__m64*>(&vertices[j + 1].position.x);
+
+            __m128 positions = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), first), second);
+            positions        = transformPair(positions, column0, column1, translation);
+            _mm_storel_pi(first, positions);
+            _mm_storeh_pi(second, positions);
+        }
+    }
+
+#elif defined(SFML_TRANSFORM_NEON)
+
+    const float32x4_t column0     = vcombine_f32(vld1_f32(&m_matrix[0]), vld1_f32(&m_matrix[0]));
+    const float32x4_t column1     = vcombine_f32(vld1_f32(&m_matrix[4]), vld1_f32(&m_matrix[4]));
+    const float32x4_t translation = vcombine_f32(vld1_f32(&m_matrix[12]), vld1_f32(&m_matrix[12]));
+
+    // Process 4 vertices per iteration
+    for (; i + 4 <= count; i += 4)
+    {
+        for (std::size_t j = i; j < i + 4; j += 2)
+        {
+            float* first  = &vertices[j].position.x;
+            float* second = &vertices[j + 1].position.x;
+
+            float32x4_t positions = vcombine_f32(vld1_f32(first), vld1_f32(second));
+            positions             = transformPair(positions, column0, column1, translation);
+            vst1_f32(first, vget_low_f32(positions));
+            vst1_f32(second, vget_high_f32(positions));
+        }
+    }
+
+#endif
+
+    // Process the remaining vertices
+    for (; i < count; ++i)
+        vertices[i].position = transformPoint(vertices[i].position);
+}
+
 } // namespace sf
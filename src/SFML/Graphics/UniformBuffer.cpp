@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+UniformBuffer::~UniformBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(UniformBuffer&& source) noexcept :
+m_buffer(std::exchange(source.m_buffer, 0U)),
+m_size(std::exchange(source.m_size, 0U))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer& UniformBuffer::operator=(UniformBuffer&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+
+    m_buffer = std::exchange(right.m_buffer, 0U);
+    m_size   = std::exchange(right.m_size, 0U);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::create(std::size_t size)
+{
+    if (!isAvailable())
+        return false;
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create uniform buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+    glCheck(
+        GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER, static_cast<GLsizeiptrARB>(size), nullptr, GLEXT_GL_DYNAMIC_DRAW));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    m_size = size;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update(const void* data, std::size_t size, std::size_t offset)
+{
+    // Sanity checks
+    if (!m_buffer || !data)
+        return false;
+
+    if (offset + size > m_size)
+    {
+        err() << "Could not update uniform buffer, the data doesn't fit in the buffer" << std::endl;
+        return false;
+    }
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+
+    // Orphan the buffer when all of it is replaced, so that we don't
+    // have to wait for the draws still reading the previous values
+    if (size == m_size)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER,
+                                   static_cast<GLsizeiptrARB>(m_size),
+                                   nullptr,
+                                   GLEXT_GL_DYNAMIC_DRAW));
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_UNIFORM_BUFFER,
+                                  static_cast<GLintptrARB>(offset),
+                                  static_cast<GLsizeiptrARB>(size),
+                                  data));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::isAvailable()
+{
+    static const bool available = []() -> bool
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        sf::priv::ensureExtensionsInit();
+
+        return GLEXT_uniform_buffer_object;
+    }();
+
+    return available;
+}
+
+} // namespace sf
@@ -108,6 +108,8 @@ VertexBuffer::~VertexBuffer()
     {
         const TransientContextLock contextLock;
 
+        resetRegions();
+
         glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
     }
 }
@@ -137,6 +139,7 @@ bool VertexBuffer::create(std::size_t vertexCount)
                                VertexBufferImpl::usageToGlEnum(m_usage)));
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
+    resetRegions();
     m_size = vertexCount;
 
     return true;
@@ -182,11 +185,12 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
                                    nullptr,
                                    VertexBufferImpl::usageToGlEnum(m_usage)));
 
+        resetRegions();
         m_size = vertexCount;
     }
 
     glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
+                                  static_cast<GLintptrARB>(sizeof(Vertex) * (m_firstVertex + offset)),
                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
                                   vertices));
 
@@ -220,8 +224,8 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
         glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
                                           GLEXT_GL_COPY_WRITE_BUFFER,
-                                          0,
-                                          0,
+                                          static_cast<GLintptr>(sizeof(Vertex) * vertexBuffer.m_firstVertex),
+                                          static_cast<GLintptr>(sizeof(Vertex) * m_firstVertex),
                                           static_cast<GLsizeiptr>(sizeof(Vertex) * vertexBuffer.m_size)));
 
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
@@ -235,6 +239,7 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
                                static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexBuffer.m_size),
                                nullptr,
                                VertexBufferImpl::usageToGlEnum(m_usage)));
+    resetRegions();
 
     void* destination = nullptr;
     glCheck(destination = GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_WRITE_ONLY));
@@ -244,7 +249,9 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
     void* source = nullptr;
     glCheck(source = GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_READ_ONLY));
 
-    std::memcpy(destination, source, sizeof(Vertex) * vertexBuffer.m_size);
+    std::memcpy(destination,
+                static_cast<const Vertex*>(source) + vertexBuffer.m_firstVertex,
+                sizeof(Vertex) * vertexBuffer.m_size);
 
     GLboolean sourceResult = GL_FALSE;
     glCheck(sourceResult = GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
@@ -262,6 +269,133 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 }
 
 
+////////////////////////////////////////////////////////////
+Vertex* VertexBuffer::map([[maybe_unused]] std::size_t vertexCount)
+{
+#ifdef SFML_OPENGL_ES
+
+    return nullptr;
+
+#else
+
+    if (!vertexCount || !isAvailable())
+        return nullptr;
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not map vertex buffer, generation failed" << std::endl;
+        return nullptr;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    void* vertices = nullptr;
+
+    if (GLEXT_map_buffer_range && GLEXT_sync)
+    {
+        if (vertexCount > m_regionSize)
+        {
+            // Allocate storage for all the regions, the driver releases
+            // the previous storage once the GPU is done with it
+            resetRegions();
+            m_regionSize = vertexCount;
+
+            glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                       static_cast<GLsizeiptrARB>(sizeof(Vertex) * m_regionSize * RegionCount),
+                                       nullptr,
+                                       VertexBufferImpl::usageToGlEnum(m_usage)));
+        }
+        else
+        {
+            // All the draws using the previous vertices have been issued by now,
+            // fence their region and move on to the next one
+            GLEXT_GLsync fence = nullptr;
+            glCheck(fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+            m_regionFences[m_region] = fence;
+            m_region                 = (m_region + 1) % RegionCount;
+        }
+
+        // Wait for the GPU to be done with the region, this only
+        // blocks if it is more than RegionCount - 1 frames behind
+        if (m_regionFences[m_region])
+        {
+            const auto fence  = static_cast<GLEXT_GLsync>(m_regionFences[m_region]);
+            GLenum     status = GLEXT_GL_TIMEOUT_EXPIRED;
+            while (status == GLEXT_GL_TIMEOUT_EXPIRED)
+                glCheck(status = GLEXT_glClientWaitSync(fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1000000));
+
+            glCheck(GLEXT_glDeleteSync(fence));
+            m_regionFences[m_region] = nullptr;
+        }
+
+        // The region is not in use anymore, no need for the driver to synchronize
+        m_firstVertex = m_region * m_regionSize;
+        glCheck(vertices = GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                                  static_cast<GLintptr>(sizeof(Vertex) * m_firstVertex),
+                                                  static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount),
+                                                  GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                                                      GLEXT_GL_MAP_UNSYNCHRONIZED_BIT));
+    }
+    else
+    {
+        // Orphan the buffer so that mapping it doesn't wait for the GPU
+        resetRegions();
+
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                   nullptr,
+                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+        glCheck(vertices = GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_WRITE_ONLY));
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    if (!vertices)
+    {
+        err() << "Could not map vertex buffer" << std::endl;
+        return nullptr;
+    }
+
+    m_size = vertexCount;
+
+    return static_cast<Vertex*>(vertices);
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::unmap()
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    if (!m_buffer)
+        return false;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    GLboolean result = GL_FALSE;
+    glCheck(result = GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    return result == GL_TRUE;
+
+#endif // SFML_OPENGL_ES
+}
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer& VertexBuffer::operator=(const VertexBuffer& right)
 {
@@ -280,6 +414,10 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_regionSize, right.m_regionSize);
+    std::swap(m_region, right.m_region);
+    std::swap(m_firstVertex, right.m_firstVertex);
+    std::swap(m_regionFences, right.m_regionFences);
 }
 
 
@@ -347,6 +485,28 @@ bool VertexBuffer::isAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void VertexBuffer::resetRegions()
+{
+#ifndef SFML_OPENGL_ES
+
+    for (void*& fence : m_regionFences)
+    {
+        if (fence)
+        {
+            glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(fence)));
+            fence = nullptr;
+        }
+    }
+
+#endif // SFML_OPENGL_ES
+
+    m_regionSize  = 0;
+    m_region      = 0;
+    m_firstVertex = 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void VertexBuffer::draw(RenderTarget& target, RenderStates states) const
 {
@@ -105,6 +105,7 @@ using ContextType = sf::priv::EglContext;
 #if defined(SFML_SYSTEM_WINDOWS)
 
 using glEnableFuncType      = void(APIENTRY*)(GLenum);
+using glFlushFuncType       = void(APIENTRY*)();
 using glGetErrorFuncType    = GLenum(APIENTRY*)();
 using glGetIntegervFuncType = void(APIENTRY*)(GLenum, GLint*);
 using glGetStringFuncType   = const GLubyte*(APIENTRY*)(GLenum);
@@ -114,6 +115,7 @@ using glIsEnabledFuncType   = GLboolean(APIENTRY*)(GLenum);
 #else
 
 using glEnableFuncType      = void (*)(GLenum);
+using glFlushFuncType       = void (*)();
 using glGetErrorFuncType    = GLenum (*)();
 using glGetIntegervFuncType = void (*)(GLenum, GLint*);
 using glGetStringFuncType   = const GLubyte* (*)(GLenum);
@@ -460,6 +462,7 @@ struct GlContext::Impl
     // Member data
     ////////////////////////////////////////////////////////////
     std::shared_ptr<UnsharedGlObjects> unsharedGlObjects; //!< The current object's handle to unshared objects
+    glFlushFuncType                    glFlushFunc{};     //!< glFlush, loaded once the context is initialized
     const std::uint64_t                id{
         []()
         {
@@ -746,6 +749,10 @@ bool GlContext::setActive(bool active)
             if (sharedContext)
                 lock = std::unique_lock(sharedContext->mutex);
 
+            // Make the commands of the context we switch from visible to the other contexts
+            if (currentContext.ptr && currentContext.ptr->m_impl->glFlushFunc)
+                currentContext.ptr->m_impl->glFlushFunc();
+
             // Activate the context
             if (makeCurrent(true))
             {
@@ -775,6 +782,10 @@ bool GlContext::setActive(bool active)
             if (sharedContext)
                 lock = std::unique_lock(sharedContext->mutex);
 
+            // Make the commands of this context visible to the other contexts
+            if (m_impl->glFlushFunc)
+                m_impl->glFlushFunc();
+
             // Deactivate the context
             if (makeCurrent(false))
             {
@@ -901,6 +912,10 @@ void GlContext::initialize(const ContextSettings& requestedSettings)
         return;
     }
 
+    // Commands issued in a context, such as texture updates, only become visible to other
+    // contexts once they are flushed: this is done whenever the context stops being active
+    m_impl->glFlushFunc = reinterpret_cast<glFlushFuncType>(getFunction("glFlush"));
+
     glGetIntegervFunc(GL_MAJOR_VERSION, &majorVersion);
     glGetIntegervFunc(GL_MINOR_VERSION, &minorVersion);
 
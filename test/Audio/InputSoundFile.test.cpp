@@ -11,6 +11,8 @@
 #include <fstream>
 #include <type_traits>
 
+#include <cmath>
+
 TEST_CASE("[Audio] sf::InputSoundFile")
 {
     SECTION("Type traits")
@@ -272,6 +274,69 @@ TEST_CASE("[Audio] sf::InputSoundFile")
         }
     }
 
+    SECTION("readFloat()")
+    {
+        sf::InputSoundFile   inputSoundFile;
+        std::array<float, 4> samples{};
+
+        SECTION("Unloaded file")
+        {
+            CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 0);
+        }
+
+        REQUIRE(inputSoundFile.openFromFile("Audio/ding.flac"));
+
+        SECTION("Null address")
+        {
+            CHECK(inputSoundFile.readFloat(nullptr, 10) == 0);
+        }
+
+        SECTION("Zero count")
+        {
+            CHECK(inputSoundFile.readFloat(samples.data(), 0) == 0);
+        }
+
+        SECTION("Successful read")
+        {
+            // Float samples carry at least the precision of the 16-bit ones
+            const auto checkSamples = [&samples](const std::array<std::int16_t, 4>& expected)
+            {
+                for (std::size_t i = 0; i < samples.size(); ++i)
+                    CHECK(std::abs(samples[i] * 32768.f - expected[i]) <= 1.f);
+            };
+
+            SECTION("flac")
+            {
+                REQUIRE(inputSoundFile.openFromFile("Audio/ding.flac"));
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                checkSamples({0, 1, -1, 4});
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                checkSamples({1, 4, 9, 6});
+                CHECK(inputSoundFile.getSampleOffset() == 8);
+            }
+
+            SECTION("mp3")
+            {
+                REQUIRE(inputSoundFile.openFromFile("Audio/ding.mp3"));
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                checkSamples({0, -2, 0, 2});
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                checkSamples({1, 4, 6, 8});
+                CHECK(inputSoundFile.getSampleOffset() == 8);
+            }
+
+            SECTION("ogg")
+            {
+                REQUIRE(inputSoundFile.openFromFile("Audio/doodle_pop.ogg"));
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                checkSamples({-827, -985, -1168, -1319});
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                checkSamples({-1738, -1883, -2358, -2497});
+                CHECK(inputSoundFile.getSampleOffset() == 8);
+            }
+        }
+    }
+
     SECTION("close()")
     {
         sf::InputSoundFile inputSoundFile;
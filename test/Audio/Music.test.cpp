@@ -7,7 +7,9 @@
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <thread>
 #include <type_traits>
@@ -75,10 +77,23 @@ TEST_CASE("[Audio] sf::Music", runAudioDeviceTests())
             CHECK(length == sf::microseconds(1990884));
             CHECK(music.getChannelCount() == 1);
             CHECK(music.getSampleRate() == 44100);
+            CHECK(music.getSampleFormat() == sf::SampleFormat::Int16);
             CHECK(music.getStatus() == sf::Music::Status::Stopped);
             CHECK(music.getPlayingOffset() == sf::Time::Zero);
             CHECK(!music.getLoop());
         }
+
+        SECTION("Float samples")
+        {
+            REQUIRE(music.openFromFile("Audio/ding.flac", sf::SampleFormat::Float32));
+            CHECK(music.getDuration() == sf::microseconds(1990884));
+            CHECK(music.getSampleFormat() == sf::SampleFormat::Float32);
+
+            music.play();
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            CHECK(music.getStatus() == sf::Music::Status::Playing);
+            CHECK(music.getPlayingOffset() > sf::Time::Zero);
+        }
     }
 
     SECTION("openFromMemory()")
@@ -207,3 +222,49 @@ TEST_CASE("[Audio] sf::Music", runAudioDeviceTests())
         }
     }
 }
+
+TEST_CASE("[Audio] sf::Music playback")
+{
+    // Run on the null backend so that the tests don't need audio hardware
+    const NullAudioBackend nullAudioBackend;
+
+    SECTION("No allocation on the audio thread")
+    {
+        std::atomic<int> processCount{};
+
+        sf::Music music;
+        REQUIRE(music.openFromFile("Audio/ding.flac"));
+
+        // Decoding happens on the decoder thread, the audio thread only copies samples
+        music.setDecodeAhead(sf::milliseconds(500));
+        music.setEffectProcessor(
+            [&processCount](const float*  inputFrames,
+                            unsigned int& inputFrameCount,
+                            float*        outputFrames,
+                            unsigned int& outputFrameCount,
+                            unsigned int  frameChannelCount)
+            {
+                markAudioThread();
+                ++processCount;
+                outputFrameCount = inputFrameCount = std::min(inputFrameCount, outputFrameCount);
+                std::copy(inputFrames, inputFrames + inputFrameCount * frameChannelCount, outputFrames);
+            });
+
+        // A first playback lets the effect processor flag the audio thread, so that the
+        // tracked playback is covered from the start of its first data source callback
+        music.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        music.stop();
+        REQUIRE(processCount > 0);
+        processCount = 0;
+
+        startAudioThreadAllocationTracking();
+        music.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        music.setPlayingOffset(sf::milliseconds(100));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        music.stop();
+        CHECK(stopAudioThreadAllocationTracking() == 0);
+        CHECK(processCount > 0);
+    }
+}
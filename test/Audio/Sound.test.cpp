@@ -9,7 +9,13 @@
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
 
 TEST_CASE("[Audio] sf::Sound", runAudioDeviceTests())
 {
@@ -82,4 +88,158 @@ TEST_CASE("[Audio] sf::Sound", runAudioDeviceTests())
         sound.setPlayingOffset(sf::seconds(10));
         CHECK(sound.getPlayingOffset() == sf::seconds(10));
     }
+
+    SECTION("Compressed buffer")
+    {
+        const auto compressedBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/ding.flac", sf::milliseconds(50))
+                                          .value();
+
+        sf::Sound sound(compressedBuffer);
+        sound.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+        CHECK(sound.getPlayingOffset() > sf::milliseconds(50));
+
+        sound.setPlayingOffset(sf::seconds(1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        CHECK(sound.getPlayingOffset() > sf::seconds(1));
+
+        const sf::Sound soundCopy(sound); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(&soundCopy.getBuffer() == &compressedBuffer);
+
+        sound.stop();
+        CHECK(sound.getStatus() == sf::Sound::Status::Stopped);
+    }
+
+    SECTION("Compressed buffer output")
+    {
+        // Start shortly before the end and loop, so that playback goes through the decoder,
+        // wraps back to the decoded prefix and crosses the seam between the prefix and the decoder
+        const auto capture = [](const sf::SoundBuffer& buffer)
+        {
+            std::vector<float>       output(44100 * 8);
+            std::atomic<std::size_t> outputCount{};
+
+            sf::Sound sound(buffer);
+            sound.setLoop(true);
+            sound.setPlayingOffset(sf::milliseconds(1500));
+            sound.setEffectProcessor(
+                [&output, &outputCount](const float*  inputFrames,
+                                        unsigned int& inputFrameCount,
+                                        float*        outputFrames,
+                                        unsigned int& outputFrameCount,
+                                        unsigned int  frameChannelCount)
+                {
+                    outputFrameCount = inputFrameCount = std::min(inputFrameCount, outputFrameCount);
+                    const std::size_t sampleCount      = inputFrameCount * frameChannelCount;
+                    std::copy(inputFrames, inputFrames + sampleCount, outputFrames);
+
+                    const std::size_t count = std::min(sampleCount, output.size() - outputCount);
+                    std::copy(inputFrames,
+                              inputFrames + count,
+                              output.begin() + static_cast<std::ptrdiff_t>(outputCount.load()));
+                    outputCount += count;
+                });
+
+            sound.play();
+            std::this_thread::sleep_for(std::chrono::milliseconds(700));
+            sound.stop();
+
+            // Drop the silence output before the sound started
+            output.resize(outputCount);
+            const auto isSilent = [](float sample) { return sample == 0.f; };
+            output.erase(output.begin(), std::find_if_not(output.begin(), output.end(), isSilent));
+            return output;
+        };
+
+        const auto decodedBuffer    = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+        const auto compressedBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/ding.flac", sf::milliseconds(50))
+                                          .value();
+
+        const std::vector<float> expected = capture(decodedBuffer);
+        const std::vector<float> actual   = capture(compressedBuffer);
+
+        // 490 ms until the end of the sound, then 50 ms of prefix: compare past the seam
+        const std::size_t count = std::min(expected.size(), actual.size());
+        REQUIRE(count > 44100 * 6 / 10);
+        CHECK(std::equal(expected.begin(),
+                         expected.begin() + static_cast<std::ptrdiff_t>(count),
+                         actual.begin()));
+    }
+}
+
+TEST_CASE("[Audio] sf::Sound playback")
+{
+    // Run on the null backend so that the tests don't need audio hardware
+    const NullAudioBackend nullAudioBackend;
+
+    const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+
+    SECTION("No allocation on the audio thread")
+    {
+        std::atomic<int> processCount{};
+
+        sf::Sound sound(soundBuffer);
+        sound.setEffectProcessor(
+            [&processCount](const float*  inputFrames,
+                            unsigned int& inputFrameCount,
+                            float*        outputFrames,
+                            unsigned int& outputFrameCount,
+                            unsigned int  frameChannelCount)
+            {
+                markAudioThread();
+                ++processCount;
+                outputFrameCount = inputFrameCount = std::min(inputFrameCount, outputFrameCount);
+                std::copy(inputFrames, inputFrames + inputFrameCount * frameChannelCount, outputFrames);
+            });
+
+        // A first playback lets the effect processor flag the audio thread, so that the
+        // tracked playback is covered from the start of its first data source callback
+        sound.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        sound.stop();
+        REQUIRE(processCount > 0);
+        processCount = 0;
+
+        startAudioThreadAllocationTracking();
+        sound.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        sound.stop();
+        CHECK(stopAudioThreadAllocationTracking() == 0);
+        CHECK(processCount > 0);
+    }
+
+    SECTION("Compressed buffer finishing on its own")
+    {
+        const auto compressedBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/ding.flac", sf::milliseconds(50))
+                                          .value();
+
+        sf::Sound sound(compressedBuffer);
+        sound.setPlayingOffset(compressedBuffer.getDuration() - sf::milliseconds(100));
+        sound.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+        // Querying the status has no side effect, so it can be done from several threads
+        std::atomic<int> stoppedCount{};
+        const auto       pollStatus = [&sound, &stoppedCount]
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                if (sound.getStatus() == sf::Sound::Status::Stopped)
+                    ++stoppedCount;
+            }
+        };
+        std::thread poller(pollStatus);
+        pollStatus();
+        poller.join();
+        CHECK(stoppedCount == 2000);
+
+        // The sound plays again from the start, with the decoder kept from the previous playback
+        sound.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+        CHECK(sound.getPlayingOffset() > sf::milliseconds(50));
+        sound.stop();
+        CHECK(sound.getStatus() == sf::Sound::Status::Stopped);
+    }
 }
@@ -59,12 +59,32 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         SECTION("Valid file")
         {
             const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Int16);
             CHECK(soundBuffer.getSamples() != nullptr);
+            CHECK(soundBuffer.getFloatSamples() == nullptr);
             CHECK(soundBuffer.getSampleCount() == 87798);
             CHECK(soundBuffer.getSampleRate() == 44100);
             CHECK(soundBuffer.getChannelCount() == 1);
             CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
         }
+
+        SECTION("Float samples")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac", sf::SampleFormat::Float32)
+                                         .value();
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBuffer.getSamples() == nullptr);
+            CHECK(soundBuffer.getFloatSamples() != nullptr);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+
+            const sf::SoundBuffer soundBufferCopy(soundBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(soundBufferCopy.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBufferCopy.getFloatSamples() != nullptr);
+            CHECK(soundBufferCopy.getSampleCount() == 87798);
+        }
     }
 
     SECTION("loadFromMemory()")
@@ -109,6 +129,139 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         }
     }
 
+    SECTION("loadFromSamples()")
+    {
+        constexpr std::array<float, 6> samples{0.f, 0.25f, 0.5f, -0.5f, -0.25f, 0.f};
+
+        SECTION("Invalid samples")
+        {
+            const float* noSamples = nullptr;
+            CHECK(!sf::SoundBuffer::loadFromSamples(noSamples, 0, 1, 44100, {sf::SoundChannel::Mono}));
+            CHECK(!sf::SoundBuffer::loadFromSamples(samples.data(), samples.size(), 0, 44100, {}));
+        }
+
+        SECTION("Float samples")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadFromSamples(samples.data(),
+                                                                      samples.size(),
+                                                                      2,
+                                                                      44100,
+                                                                      {sf::SoundChannel::FrontLeft,
+                                                                       sf::SoundChannel::FrontRight})
+                                         .value();
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBuffer.getFloatSamples() != nullptr);
+            CHECK(soundBuffer.getFloatSamples()[1] == 0.25f);
+            CHECK(soundBuffer.getSampleCount() == 6);
+            CHECK(soundBuffer.getChannelCount() == 2);
+        }
+    }
+
+    SECTION("loadCompressedFromFile()")
+    {
+        SECTION("Invalid filename")
+        {
+            CHECK(!sf::SoundBuffer::loadCompressedFromFile("does/not/exist.wav"));
+        }
+
+        SECTION("Valid file")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/ding.flac").value();
+            CHECK(soundBuffer.getStorageMode() == sf::SoundBuffer::StorageMode::Compressed);
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Int16);
+            CHECK(soundBuffer.getSamples() == nullptr);
+            CHECK(soundBuffer.getFloatSamples() == nullptr);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+            CHECK(soundBuffer.getMemoryUsage() >= 56364 + 4410 * sizeof(std::int16_t));
+            CHECK(soundBuffer.getMemoryUsage() < 87798 * sizeof(std::int16_t));
+
+            const sf::SoundBuffer soundBufferCopy(soundBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(soundBufferCopy.getStorageMode() == sf::SoundBuffer::StorageMode::Compressed);
+            CHECK(soundBufferCopy.getSampleCount() == 87798);
+            CHECK(soundBufferCopy.getMemoryUsage() >= 56364 + 4410 * sizeof(std::int16_t));
+        }
+
+        SECTION("Prefix duration")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/ding.flac", sf::Time::Zero).value();
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getMemoryUsage() >= 56364);
+            CHECK(soundBuffer.getMemoryUsage() < 56364 + 4410 * sizeof(std::int16_t));
+
+            const auto wholeBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/ding.flac", sf::seconds(10))
+                                         .value();
+            CHECK(wholeBuffer.getSampleCount() == 87798);
+            CHECK(wholeBuffer.getMemoryUsage() >= 56364 + 87798 * sizeof(std::int16_t));
+        }
+
+        SECTION("Float samples")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/doodle_pop.ogg",
+                                                                             sf::milliseconds(100),
+                                                                             sf::SampleFormat::Float32)
+                                         .value();
+            CHECK(soundBuffer.getStorageMode() == sf::SoundBuffer::StorageMode::Compressed);
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBuffer.getSampleCount() == 2'116'992);
+            CHECK(soundBuffer.getChannelCount() == 2);
+            CHECK(soundBuffer.getMemoryUsage() >= 116492 + 8820 * sizeof(float));
+        }
+
+        SECTION("Memory usage")
+        {
+            const auto decodedBuffer    = sf::SoundBuffer::loadFromFile("Audio/doodle_pop.ogg").value();
+            const auto compressedBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/doodle_pop.ogg").value();
+            CHECK(decodedBuffer.getStorageMode() == sf::SoundBuffer::StorageMode::Decoded);
+            CHECK(decodedBuffer.getMemoryUsage() >= 2'116'992 * sizeof(std::int16_t));
+            CHECK(compressedBuffer.getMemoryUsage() < decodedBuffer.getMemoryUsage() / 10);
+        }
+    }
+
+    SECTION("loadCompressedFromMemory()")
+    {
+        SECTION("Invalid memory")
+        {
+            CHECK(!sf::SoundBuffer::loadCompressedFromMemory(nullptr, 0));
+            constexpr std::array<std::byte, 5> memory{};
+            CHECK(!sf::SoundBuffer::loadCompressedFromMemory(memory.data(), memory.size()));
+        }
+
+        SECTION("Valid memory")
+        {
+            const auto memory      = loadIntoMemory("Audio/ding.flac");
+            const auto soundBuffer = sf::SoundBuffer::loadCompressedFromMemory(memory.data(), memory.size()).value();
+            CHECK(soundBuffer.getStorageMode() == sf::SoundBuffer::StorageMode::Compressed);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+        }
+    }
+
+    SECTION("loadCompressedFromStream()")
+    {
+        sf::FileInputStream stream;
+
+        SECTION("Invalid stream")
+        {
+            CHECK(!sf::SoundBuffer::loadCompressedFromStream(stream));
+        }
+
+        SECTION("Valid stream")
+        {
+            REQUIRE(stream.open("Audio/ding.flac"));
+            const auto soundBuffer = sf::SoundBuffer::loadCompressedFromStream(stream).value();
+            CHECK(soundBuffer.getStorageMode() == sf::SoundBuffer::StorageMode::Compressed);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+        }
+    }
+
     SECTION("saveToFile()")
     {
         const auto filename = std::filesystem::temp_directory_path() / "ding.flac";
@@ -127,4 +280,22 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
 
         CHECK(std::filesystem::remove(filename));
     }
+
+    SECTION("saveToFile() from compressed data")
+    {
+        const auto filename = std::filesystem::temp_directory_path() / "ding_compressed.flac";
+
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadCompressedFromFile("Audio/ding.flac").value();
+            REQUIRE(soundBuffer.saveToFile(filename));
+        }
+
+        const auto soundBuffer = sf::SoundBuffer::loadFromFile(filename).value();
+        CHECK(soundBuffer.getSamples() != nullptr);
+        CHECK(soundBuffer.getSampleCount() == 87798);
+        CHECK(soundBuffer.getSampleRate() == 44100);
+        CHECK(soundBuffer.getChannelCount() == 1);
+
+        CHECK(std::filesystem::remove(filename));
+    }
 }
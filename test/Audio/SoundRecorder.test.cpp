@@ -1,5 +1,10 @@
 #include <SFML/Audio/SoundRecorder.hpp>
 
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <atomic>
+#include <thread>
 #include <type_traits>
 
 static_assert(!std::is_constructible_v<sf::SoundRecorder>);
@@ -7,3 +12,51 @@ static_assert(!std::is_copy_constructible_v<sf::SoundRecorder>);
 static_assert(!std::is_copy_assignable_v<sf::SoundRecorder>);
 static_assert(!std::is_nothrow_move_constructible_v<sf::SoundRecorder>);
 static_assert(!std::is_nothrow_move_assignable_v<sf::SoundRecorder>);
+
+namespace
+{
+class SoundRecorder : public sf::SoundRecorder
+{
+public:
+    ~SoundRecorder() override
+    {
+        stop();
+    }
+
+    std::atomic<std::size_t> sampleCount{};
+
+private:
+    [[nodiscard]] bool onProcessSamples(const std::int16_t* /* samples */, std::size_t count) override
+    {
+        markAudioThread();
+        sampleCount += count;
+        return true;
+    }
+};
+} // namespace
+
+TEST_CASE("[Audio] sf::SoundRecorder")
+{
+    // Run on the null backend so that the tests don't need a capture device
+    const NullAudioBackend nullAudioBackend;
+
+    SECTION("No allocation on the audio thread")
+    {
+        SoundRecorder soundRecorder;
+
+        // A first capture lets onProcessSamples flag the audio thread, so that the
+        // tracked capture is covered from the start of its first callback
+        REQUIRE(soundRecorder.start());
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        soundRecorder.stop();
+        REQUIRE(soundRecorder.sampleCount > 0);
+        soundRecorder.sampleCount = 0;
+
+        startAudioThreadAllocationTracking();
+        REQUIRE(soundRecorder.start());
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        soundRecorder.stop();
+        CHECK(stopAudioThreadAllocationTracking() == 0);
+        CHECK(soundRecorder.sampleCount > 0);
+    }
+}
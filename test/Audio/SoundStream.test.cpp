@@ -1,10 +1,14 @@
 #include <SFML/Audio/SoundStream.hpp>
 
+// Other 1st party headers
+#include <SFML/System/Sleep.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -19,6 +23,42 @@ class SoundStream : public sf::SoundStream
     {
     }
 };
+
+class GeneratorStream : public sf::SoundStream
+{
+public:
+    explicit GeneratorStream(sf::Time delay = sf::Time::Zero, sf::SampleFormat sampleFormat = sf::SampleFormat::Int16) :
+    m_delay(delay),
+    m_samples(882),
+    m_floatSamples(882)
+    {
+        // 10 ms of stereo audio per chunk
+        initialize(2, 44100, {sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight}, sampleFormat);
+    }
+
+    ~GeneratorStream() override
+    {
+        stop();
+    }
+
+private:
+    [[nodiscard]] bool onGetData(Chunk& data) override
+    {
+        sf::sleep(m_delay);
+        data.samples      = m_samples.data();
+        data.floatSamples = m_floatSamples.data();
+        data.sampleCount  = m_samples.size();
+        return true;
+    }
+
+    void onSeek(sf::Time /* timeOffset */) override
+    {
+    }
+
+    sf::Time                  m_delay;
+    std::vector<std::int16_t> m_samples;
+    std::vector<float>        m_floatSamples;
+};
 } // namespace
 
 TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
@@ -38,6 +78,7 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
         const sf::SoundStream::Chunk chunk;
         CHECK(chunk.samples == nullptr);
         CHECK(chunk.sampleCount == 0);
+        CHECK(chunk.floatSamples == nullptr);
     }
 
     SECTION("Construction")
@@ -45,9 +86,12 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
         const SoundStream soundStream;
         CHECK(soundStream.getChannelCount() == 0);
         CHECK(soundStream.getSampleRate() == 0);
+        CHECK(soundStream.getSampleFormat() == sf::SampleFormat::Int16);
         CHECK(soundStream.getStatus() == sf::SoundStream::Status::Stopped);
         CHECK(soundStream.getPlayingOffset() == sf::Time::Zero);
         CHECK(!soundStream.getLoop());
+        CHECK(soundStream.getDecodeAhead() == sf::Time::Zero);
+        CHECK(soundStream.getUnderrunCount() == 0);
     }
 
     SECTION("Set/get playing offset")
@@ -63,4 +107,82 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
         soundStream.setLoop(true);
         CHECK(soundStream.getLoop());
     }
+
+    SECTION("Set/get decode ahead")
+    {
+        SoundStream soundStream;
+        soundStream.setDecodeAhead(sf::milliseconds(250));
+        CHECK(soundStream.getDecodeAhead() == sf::milliseconds(250));
+    }
+}
+
+TEST_CASE("[Audio] sf::SoundStream playback")
+{
+    // Run on the null backend so that the decode-ahead stress tests don't need audio hardware
+    const NullAudioBackend nullAudioBackend;
+
+    SECTION("Float samples")
+    {
+        GeneratorStream soundStream(sf::Time::Zero, sf::SampleFormat::Float32);
+        CHECK(soundStream.getSampleFormat() == sf::SampleFormat::Float32);
+
+        SECTION("Synchronous")
+        {
+            soundStream.play();
+            sf::sleep(sf::milliseconds(100));
+            CHECK(soundStream.getStatus() == sf::SoundStream::Status::Playing);
+            CHECK(soundStream.getPlayingOffset() > sf::Time::Zero);
+        }
+
+        SECTION("Decode ahead")
+        {
+            soundStream.setDecodeAhead(sf::milliseconds(200));
+            soundStream.play();
+            sf::sleep(sf::milliseconds(100));
+            CHECK(soundStream.getStatus() == sf::SoundStream::Status::Playing);
+            CHECK(soundStream.getPlayingOffset() > sf::Time::Zero);
+            CHECK(soundStream.getUnderrunCount() == 0);
+        }
+    }
+
+    SECTION("Decode ahead")
+    {
+        SECTION("Source faster than playback")
+        {
+            GeneratorStream soundStream;
+            soundStream.setDecodeAhead(sf::milliseconds(500));
+            soundStream.play();
+            sf::sleep(sf::milliseconds(200));
+            CHECK(soundStream.getStatus() == sf::SoundStream::Status::Playing);
+            CHECK(soundStream.getPlayingOffset() > sf::Time::Zero);
+
+            // Hammer the decoder thread with seeks while the audio thread keeps pulling samples
+            for (int i = 0; i < 50; ++i)
+            {
+                soundStream.setPlayingOffset(sf::milliseconds(i * 20));
+                sf::sleep(sf::milliseconds(2));
+            }
+
+            soundStream.pause();
+            CHECK(soundStream.getStatus() == sf::SoundStream::Status::Paused);
+            soundStream.play();
+            sf::sleep(sf::milliseconds(100));
+            CHECK(soundStream.getStatus() == sf::SoundStream::Status::Playing);
+            CHECK(soundStream.getUnderrunCount() == 0);
+
+            soundStream.stop();
+            CHECK(soundStream.getStatus() == sf::SoundStream::Status::Stopped);
+            CHECK(soundStream.getPlayingOffset() == sf::Time::Zero);
+        }
+
+        SECTION("Source slower than playback")
+        {
+            GeneratorStream soundStream(sf::milliseconds(50));
+            soundStream.setDecodeAhead(sf::milliseconds(100));
+            soundStream.play();
+            sf::sleep(sf::milliseconds(300));
+            CHECK(soundStream.getStatus() == sf::SoundStream::Status::Playing);
+            CHECK(soundStream.getUnderrunCount() > 0);
+        }
+    }
 }
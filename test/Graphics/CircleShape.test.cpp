@@ -2,7 +2,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
-#include <SystemUtil.hpp>
+#include <GraphicsUtil.hpp>
 #include <type_traits>
 
 TEST_CASE("[Graphics] sf::CircleShape")
@@ -107,6 +107,59 @@ TEST_CASE("[Graphics] sf::CircleShape")
         CHECK(circle.getGeometricCenter() == sf::Vector2f(4.f, 4.f));
     }
 
+    SECTION("Bounds")
+    {
+        sf::CircleShape circle(10.f, 4);
+        CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({0, 0}, {20, 20})));
+
+        SECTION("Set radius")
+        {
+            circle.setRadius(5.f);
+            circle.setRadius(15.f);
+            CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({0, 0}, {30, 30})));
+        }
+
+        SECTION("Set point count")
+        {
+            circle.setPointCount(30);
+            CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({0, 0}, {20, 20})));
+        }
+
+        SECTION("Set outline thickness")
+        {
+            circle.setOutlineThickness(2.f);
+            circle.setRadius(5.f);
+            CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({-2.828427f, -2.828427f}, {15.656854f, 15.656854f})));
+
+            circle.setOutlineThickness(0.f);
+            CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({0, 0}, {10, 10})));
+        }
+
+        SECTION("Set radius with an outline")
+        {
+            circle.setOutlineThickness(2.f);
+            CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({-2.828427f, -2.828427f}, {25.656854f, 25.656854f})));
+
+            // The outline is moved along with the scaled points
+            circle.setRadius(5.f);
+            CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({-2.828427f, -2.828427f}, {15.656854f, 15.656854f})));
+
+            // A circle without a radius can't be scaled, its outline is computed again
+            circle.setRadius(0.f);
+            CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({0, 0}, {0, 0})));
+            circle.setRadius(5.f);
+            CHECK(circle.getLocalBounds() == Approx(sf::FloatRect({-2.828427f, -2.828427f}, {15.656854f, 15.656854f})));
+        }
+    }
+
+    SECTION("Circles sharing a point count")
+    {
+        const sf::CircleShape small(1.f, 6);
+        const sf::CircleShape large(10.f, 6);
+        for (std::size_t i = 0; i < 6; ++i)
+            CHECK(large.getPoint(i) == Approx(small.getPoint(i) * 10.f));
+    }
+
     SECTION("Equilateral triangle")
     {
         const sf::CircleShape triangle(2.f, 3);
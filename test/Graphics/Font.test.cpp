@@ -2,12 +2,17 @@
 #include <SFML/Graphics/Texture.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Text.hpp>
+
 #include <SFML/System/FileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <algorithm>
 #include <fstream>
 #include <type_traits>
 
@@ -136,4 +141,175 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("Alpha-only atlas")
+    {
+        auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        CHECK(!font.isAlphaOnlyAtlas());
+
+        const auto renderText = [](const sf::Font& textFont)
+        {
+            sf::RenderTexture renderTexture;
+            REQUIRE(renderTexture.create({100, 40}));
+            renderTexture.clear(sf::Color::Blue);
+            sf::Text text(textFont, "Hello", 24);
+            text.setFillColor(sf::Color::Yellow);
+            renderTexture.draw(text);
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const sf::Image expected = renderText(font);
+
+        font.setAlphaOnlyAtlas(true);
+        CHECK(font.isAlphaOnlyAtlas());
+        const sf::Image image = renderText(font);
+        REQUIRE(image.getSize() == expected.getSize());
+        CHECK(std::equal(image.getPixelsPtr(), image.getPixelsPtr() + 100 * 40 * 4, expected.getPixelsPtr()));
+
+        // Atlases keep working as they grow
+        font.preloadGlyphs({{0x20, 0x17F}}, 48, false);
+        CHECK(font.getTexture(48).getSize().x > 128);
+        const sf::Image atlas = font.getTexture(48).copyToImage();
+        CHECK(atlas.getPixel({0, 0}) == sf::Color::White);
+        CHECK(atlas.getPixel({127, 127}).r == 255);
+    }
+
+    SECTION("Glyph cache")
+    {
+        const auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+
+        SECTION("Basic Multilingual Plane")
+        {
+            const auto& glyph = font.getGlyph(0x45, 16, false);
+            CHECK(&font.getGlyph(0x45, 16, false) == &glyph);
+            CHECK(&font.getGlyph(0x45, 16, true) != &glyph);
+            CHECK(&font.getGlyph(0x45, 16, false, 1) != &glyph);
+            CHECK(&font.getGlyph(0x45, 24, false) != &glyph);
+            CHECK(&font.getGlyph(0x45, 16, false) == &glyph);
+            CHECK(glyph.advance == 9);
+        }
+
+        SECTION("Outside of the Basic Multilingual Plane")
+        {
+            const auto& glyph = font.getGlyph(0x1F600, 16, false);
+            CHECK(&font.getGlyph(0x1F600, 16, false) == &glyph);
+        }
+
+        SECTION("Kerning")
+        {
+            CHECK(font.getKerning(0x41, 0x42, 12) == -1);
+            CHECK(font.getKerning(0x41, 0x42, 12) == -1);
+            CHECK(font.getKerning(0x43, 0x44, 24, true) == 0);
+            CHECK(font.getKerning(0x43, 0x44, 24, true) == 0);
+            CHECK(font.getKerning(0x41, 0, 12) == 0);
+        }
+    }
+
+    SECTION("Preload glyphs")
+    {
+        const auto font      = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        const auto reference = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+
+        font.preloadGlyphs({{0x20, 0x7E}, {0xC0, 0xFF}}, 24, false);
+        const std::size_t glyphCount = font.getAtlasStats(24).glyphCount;
+        CHECK(glyphCount > 0);
+
+        for (std::uint32_t codePoint = 0x20; codePoint <= 0x7E; ++codePoint)
+        {
+            const sf::Glyph& glyph         = font.getGlyph(codePoint, 24, false);
+            const sf::Glyph& expectedGlyph = reference.getGlyph(codePoint, 24, false);
+            CHECK(glyph.advance == expectedGlyph.advance);
+            CHECK(glyph.bounds == expectedGlyph.bounds);
+            CHECK(glyph.textureRect.getSize() == expectedGlyph.textureRect.getSize());
+        }
+
+        // Preloaded glyphs are found in the cache
+        CHECK(font.getAtlasStats(24).glyphCount == glyphCount);
+
+        // Glyphs which are already cached are skipped
+        font.preloadGlyphs({{0x41, 0x5A}}, 24, false);
+        CHECK(font.getAtlasStats(24).glyphCount == glyphCount);
+
+        // Other styles are cached separately
+        font.preloadGlyphs({{0x41, 0x5A}}, 24, true, 1);
+        CHECK(font.getAtlasStats(24).glyphCount > glyphCount);
+    }
+
+    SECTION("Set/get maximum atlas size")
+    {
+        auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        CHECK(font.getMaximumAtlasSize() == 0);
+        font.setMaximumAtlasSize(256);
+        CHECK(font.getMaximumAtlasSize() == 256);
+    }
+
+    SECTION("Distance field")
+    {
+        auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        CHECK(font.getDistanceFieldSize() == 64);
+        CHECK(font.getDistanceFieldSpread() == 8);
+
+        const sf::Glyph glyph = font.getDistanceFieldGlyph(0x45, false);
+        CHECK(glyph.advance == font.getGlyph(0x45, 64, false).advance);
+        CHECK(glyph.bounds == font.getGlyph(0x45, 64, false).bounds);
+        CHECK(glyph.textureRect.width == static_cast<int>(glyph.bounds.width));
+        CHECK(glyph.textureRect.height == static_cast<int>(glyph.bounds.height));
+
+        // The distance field is above 0.5 on the stem of the 'E', and extends beyond the glyph
+        const sf::Image image = font.getDistanceFieldTexture().copyToImage();
+        const auto      stem  = glyph.textureRect.getPosition() + sf::Vector2i(2, glyph.textureRect.height / 2);
+        CHECK(image.getPixel(sf::Vector2u(stem)).a > 128);
+        CHECK(image.getPixel(sf::Vector2u(glyph.textureRect.getPosition() - sf::Vector2i(1, 1))).a > 0);
+
+        font.setDistanceFieldSize(32);
+        CHECK(font.getDistanceFieldSize() == 32);
+        CHECK(font.getDistanceFieldSpread() == 4);
+        CHECK(font.getDistanceFieldGlyph(0x45, false).advance == font.getGlyph(0x45, 32, false).advance);
+    }
+
+    SECTION("Atlas")
+    {
+        auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+
+        SECTION("Empty page")
+        {
+            const sf::Font::AtlasStats stats = font.getAtlasStats(16);
+            CHECK(stats.size == sf::Vector2u(128, 128));
+            CHECK(stats.occupancy == 0);
+            CHECK(stats.glyphCount == 0);
+            CHECK(stats.evictionCount == 0);
+        }
+
+        SECTION("Growth")
+        {
+            for (std::uint32_t codePoint = 0x21; codePoint < 0x17F; ++codePoint)
+                (void)font.getGlyph(codePoint, 32, false);
+
+            const sf::Font::AtlasStats stats = font.getAtlasStats(32);
+            CHECK(stats.size.x > 128);
+            CHECK(stats.size.y > 128);
+            CHECK(stats.occupancy > 0);
+            CHECK(stats.occupancy <= 1);
+            CHECK(stats.glyphCount > 0);
+            CHECK(stats.evictionCount == 0);
+        }
+
+        SECTION("Eviction")
+        {
+            font.setMaximumAtlasSize(128);
+            for (std::uint32_t codePoint = 0x21; codePoint < 0x17F; ++codePoint)
+                (void)font.getGlyph(codePoint, 32, false);
+
+            const sf::Font::AtlasStats stats = font.getAtlasStats(32);
+            CHECK(stats.size == sf::Vector2u(128, 128));
+            CHECK(stats.occupancy <= 1);
+            CHECK(stats.evictionCount > 0);
+
+            // Evicted glyphs are reloaded transparently
+            const sf::Glyph glyph = font.getGlyph(0x45, 32, false);
+            CHECK(glyph.textureRect.width > 0);
+            CHECK(glyph.advance == font.getGlyph(0x45, 32, false).advance);
+        }
+    }
 }
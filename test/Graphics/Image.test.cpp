@@ -446,6 +446,20 @@ TEST_CASE("[Graphics] sf::Image")
         image.flipHorizontally();
 
         CHECK(image.getPixel(sf::Vector2u(9, 0)) == sf::Color::Green);
+
+        SECTION("Odd width")
+        {
+            sf::Image row(sf::Vector2u(13, 1));
+            for (std::uint8_t x = 0; x < 13; ++x)
+                row.setPixel(sf::Vector2u(x, 0), sf::Color(x, 2 * x, 3 * x, 4 * x));
+            row.flipHorizontally();
+
+            for (std::uint8_t x = 0; x < 13; ++x)
+            {
+                const auto flipped = static_cast<std::uint8_t>(12 - x);
+                CHECK(row.getPixel(sf::Vector2u(x, 0)) == sf::Color(flipped, 2 * flipped, 3 * flipped, 4 * flipped));
+            }
+        }
     }
 
     SECTION("Flip vertically")
@@ -456,4 +470,41 @@ TEST_CASE("[Graphics] sf::Image")
 
         CHECK(image.getPixel(sf::Vector2u(0, 9)) == sf::Color::Green);
     }
+
+    SECTION("Blend pixels of any alpha")
+    {
+        // Every combination of source and destination alpha must match the documented integer formula
+        sf::Image source(sf::Vector2u(256, 256));
+        sf::Image destination(sf::Vector2u(256, 256));
+        for (unsigned int y = 0; y < 256; ++y)
+        {
+            for (unsigned int x = 0; x < 256; ++x)
+            {
+                const auto srcAlpha = static_cast<std::uint8_t>(x);
+                const auto dstAlpha = static_cast<std::uint8_t>(y);
+                source.setPixel(sf::Vector2u(x, y), sf::Color(200, 17, 0, srcAlpha));
+                destination.setPixel(sf::Vector2u(x, y), sf::Color(3, 90, 255, dstAlpha));
+            }
+        }
+
+        sf::Image blended = destination;
+        REQUIRE(blended.copy(source, sf::Vector2u(0, 0), sf::IntRect(), true));
+
+        for (unsigned int y = 0; y < 256; ++y)
+        {
+            for (unsigned int x = 0; x < 256; ++x)
+            {
+                const sf::Color src      = source.getPixel(sf::Vector2u(x, y));
+                const sf::Color dst      = destination.getPixel(sf::Vector2u(x, y));
+                const auto      outAlpha = static_cast<std::uint8_t>(src.a + dst.a - src.a * dst.a / 255);
+                const auto      mix      = [&](std::uint8_t s, std::uint8_t d)
+                {
+                    return outAlpha ? static_cast<std::uint8_t>((s * src.a + d * (outAlpha - src.a)) / outAlpha) : s;
+                };
+
+                CHECK(blended.getPixel(sf::Vector2u(x, y)) ==
+                      sf::Color(mix(src.r, dst.r), mix(src.g, dst.g), mix(src.b, dst.b), outAlpha));
+            }
+        }
+    }
 }
@@ -0,0 +1,143 @@
+#include <SFML/Graphics/ImageLoader.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Err.hpp>
+#include <SFML/System/FileInputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <future>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::ImageLoader")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ImageLoader>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ImageLoader>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::ImageLoader>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::ImageLoader>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::ImageLoader imageLoader;
+            CHECK(imageLoader.getThreadCount() > 0);
+        }
+
+        SECTION("Thread count constructor")
+        {
+            const sf::ImageLoader imageLoader(3);
+            CHECK(imageLoader.getThreadCount() == 3);
+        }
+    }
+
+    sf::ImageLoader imageLoader(2);
+
+    SECTION("loadFromFile()")
+    {
+        SECTION("Invalid file")
+        {
+            CHECK(!imageLoader.loadFromFile("this/does/not/exist.jpg").get());
+        }
+
+        SECTION("Successful load")
+        {
+            const auto image = imageLoader.loadFromFile("Graphics/sfml-logo-big.png").get();
+            REQUIRE(image);
+            CHECK(image->getSize() == sf::Vector2u(1001, 304));
+            CHECK(image->getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
+            CHECK(image->getPixel({200, 150}) == sf::Color(144, 208, 62));
+        }
+    }
+
+    SECTION("loadFromFiles()")
+    {
+        const std::vector<std::filesystem::path> filenames = {"Graphics/sfml-logo-big.bmp",
+                                                              "Graphics/sfml-logo-big.png",
+                                                              "Graphics/sfml-logo-big.jpg",
+                                                              "this/does/not/exist.jpg",
+                                                              "Graphics/sfml-logo-big.gif",
+                                                              "Graphics/sfml-logo-big.psd"};
+
+        auto futures = imageLoader.loadFromFiles(filenames);
+        REQUIRE(futures.size() == filenames.size());
+
+        // The results must be identical to loading the images on the calling thread
+        for (std::size_t i = 0; i < filenames.size(); ++i)
+        {
+            const auto image    = futures[i].get();
+            const auto expected = sf::Image::loadFromFile(filenames[i]);
+            REQUIRE(image.has_value() == expected.has_value());
+
+            if (image)
+            {
+                CHECK(image->getSize() == expected->getSize());
+                CHECK(std::equal(image->getPixelsPtr(),
+                                 image->getPixelsPtr() + image->getSize().x * image->getSize().y * 4,
+                                 expected->getPixelsPtr()));
+            }
+        }
+    }
+
+    SECTION("Failures in parallel")
+    {
+        // Every failure is reported to sf::err(), which must not be written to concurrently
+        std::stringstream stream;
+        auto* const       defaultStreamBuffer = sf::err().rdbuf(stream.rdbuf());
+
+        sf::ImageLoader                                    parallelLoader(4);
+        const std::vector<char>                            corruptData(64, 'x');
+        std::vector<std::filesystem::path>                 filenames;
+        std::vector<std::future<std::optional<sf::Image>>> futures;
+        for (int i = 0; i < 32; ++i)
+        {
+            filenames.emplace_back("this/does/not/exist" + std::to_string(i) + ".png");
+            futures.push_back(parallelLoader.loadFromMemory(corruptData.data(), corruptData.size()));
+        }
+
+        for (auto& future : parallelLoader.loadFromFiles(filenames))
+            futures.push_back(std::move(future));
+
+        for (auto& future : futures)
+            CHECK(!future.get());
+
+        sf::err().rdbuf(defaultStreamBuffer);
+
+        // Each message must have been written in one piece
+        std::size_t fileErrorCount   = 0;
+        std::size_t memoryErrorCount = 0;
+        for (std::string line; std::getline(stream, line);)
+        {
+            if (line == "Failed to load image")
+                ++fileErrorCount;
+            else if (line.rfind("Failed to load image from memory. Reason: ", 0) == 0)
+                ++memoryErrorCount;
+        }
+
+        CHECK(fileErrorCount == 32);
+        CHECK(memoryErrorCount == 32);
+    }
+
+    SECTION("loadFromMemory()")
+    {
+        sf::FileInputStream stream;
+        REQUIRE(stream.open("Graphics/sfml-logo-big.png"));
+        std::vector<char> data(static_cast<std::size_t>(stream.getSize()));
+        REQUIRE(stream.read(data.data(), static_cast<std::int64_t>(data.size())) == stream.getSize());
+
+        const auto image = imageLoader.loadFromMemory(data.data(), data.size()).get();
+        REQUIRE(image);
+        CHECK(image->getSize() == sf::Vector2u(1001, 304));
+    }
+}
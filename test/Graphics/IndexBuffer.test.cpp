@@ -0,0 +1,188 @@
+#include <SFML/Graphics/IndexBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::IndexBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_nothrow_swappable_v<sf::IndexBuffer>);
+    }
+
+    // Skip tests if index buffers aren't available
+    if (!sf::IndexBuffer::isAvailable())
+        return;
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::IndexBuffer indexBuffer;
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getIndexType() == sf::IndexBuffer::IndexType::UInt16);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Static);
+        }
+
+        SECTION("Index type constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::IndexType::UInt32);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getIndexType() == sf::IndexBuffer::IndexType::UInt32);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Static);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::Usage::Stream);
+            CHECK(indexBuffer.getIndexType() == sf::IndexBuffer::IndexType::UInt16);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Stream);
+        }
+
+        SECTION("Index type and usage constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::IndexType::UInt32, sf::IndexBuffer::Usage::Dynamic);
+            CHECK(indexBuffer.getIndexType() == sf::IndexBuffer::IndexType::UInt32);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+        }
+    }
+
+    SECTION("create()")
+    {
+        sf::IndexBuffer indexBuffer;
+        CHECK(indexBuffer.create(100));
+        CHECK(indexBuffer.getIndexCount() == 100);
+        CHECK(indexBuffer.getNativeHandle() != 0);
+    }
+
+    SECTION("update()")
+    {
+        constexpr std::array<std::uint16_t, 6> indices16 = {0, 1, 2, 2, 1, 3};
+        constexpr std::array<std::uint32_t, 6> indices32 = {0, 1, 2, 2, 1, 3};
+
+        sf::IndexBuffer indexBuffer;
+
+        SECTION("Uninitialized buffer")
+        {
+            CHECK(!indexBuffer.update(indices16.data(), indices16.size()));
+        }
+
+        CHECK(indexBuffer.create(6));
+
+        SECTION("Null indices")
+        {
+            CHECK(!indexBuffer.update(static_cast<const std::uint16_t*>(nullptr), 6));
+        }
+
+        SECTION("Mismatched index type")
+        {
+            CHECK(!indexBuffer.update(indices32.data(), indices32.size()));
+        }
+
+        SECTION("Count + offset too large")
+        {
+            CHECK(!indexBuffer.update(indices16.data(), 4, 4));
+        }
+
+        CHECK(indexBuffer.update(indices16.data(), indices16.size()));
+        CHECK(indexBuffer.update(indices16.data(), 2, 4));
+        CHECK(indexBuffer.getIndexCount() == 6);
+    }
+
+    SECTION("swap()")
+    {
+        sf::IndexBuffer indexBuffer1(sf::IndexBuffer::IndexType::UInt16, sf::IndexBuffer::Usage::Dynamic);
+        CHECK(indexBuffer1.create(50));
+
+        sf::IndexBuffer indexBuffer2(sf::IndexBuffer::IndexType::UInt32, sf::IndexBuffer::Usage::Stream);
+        CHECK(indexBuffer2.create(60));
+
+        sf::swap(indexBuffer1, indexBuffer2);
+
+        CHECK(indexBuffer1.getIndexCount() == 60);
+        CHECK(indexBuffer1.getIndexType() == sf::IndexBuffer::IndexType::UInt32);
+        CHECK(indexBuffer1.getUsage() == sf::IndexBuffer::Usage::Stream);
+
+        CHECK(indexBuffer2.getIndexCount() == 50);
+        CHECK(indexBuffer2.getIndexType() == sf::IndexBuffer::IndexType::UInt16);
+        CHECK(indexBuffer2.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Set/get usage")
+    {
+        sf::IndexBuffer indexBuffer;
+        indexBuffer.setUsage(sf::IndexBuffer::Usage::Dynamic);
+        CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Draw")
+    {
+        // A quad covering the left half of the target, as two triangles sharing two vertices
+        const std::array<sf::Vertex, 4> vertices = {sf::Vertex{{0, 0}, sf::Color::Green},
+                                                    sf::Vertex{{0, 10}, sf::Color::Green},
+                                                    sf::Vertex{{5, 0}, sf::Color::Green},
+                                                    sf::Vertex{{5, 10}, sf::Color::Green}};
+        constexpr std::array<std::uint16_t, 6> indices16 = {0, 1, 2, 2, 1, 3};
+        constexpr std::array<std::uint32_t, 6> indices32 = {0, 1, 2, 2, 1, 3};
+
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({10, 10}));
+        renderTexture.clear(sf::Color::Red);
+
+        SECTION("Client-side 16-bit indices")
+        {
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices16.data(),
+                               indices16.size(),
+                               sf::PrimitiveType::Triangles);
+        }
+
+        SECTION("Client-side 32-bit indices")
+        {
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices32.data(),
+                               indices32.size(),
+                               sf::PrimitiveType::Triangles);
+        }
+
+        SECTION("Index buffer")
+        {
+            sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles);
+            REQUIRE(vertexBuffer.create(vertices.size()));
+            REQUIRE(vertexBuffer.update(vertices.data()));
+
+            sf::IndexBuffer indexBuffer(sf::IndexBuffer::IndexType::UInt32);
+            REQUIRE(indexBuffer.create(indices32.size()));
+            REQUIRE(indexBuffer.update(indices32.data(), indices32.size()));
+
+            renderTexture.draw(vertexBuffer, indexBuffer);
+        }
+
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({1, 8}) == sf::Color::Green);
+        CHECK(image.getPixel({4, 1}) == sf::Color::Green);
+        CHECK(image.getPixel({8, 5}) == sf::Color::Red);
+    }
+}
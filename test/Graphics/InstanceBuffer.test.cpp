@@ -0,0 +1,195 @@
+#include <SFML/Graphics/InstanceBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::InstanceBuffer", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::InstanceBuffer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::InstanceBuffer>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::InstanceBuffer>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::InstanceBuffer>);
+        STATIC_CHECK(std::is_nothrow_swappable_v<sf::InstanceBuffer>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::InstanceBuffer instances;
+        CHECK(instances.getInstanceCount() == 0);
+    }
+
+    const auto transform = sf::Transform().translate({10, 20}).rotate(sf::degrees(90)).scale({2, 3});
+
+    SECTION("Append")
+    {
+        sf::InstanceBuffer instances;
+        instances.append(transform, sf::Color::Red);
+        instances.append(sf::Transform::Identity);
+        CHECK(instances.getInstanceCount() == 2);
+        CHECK(instances.getTransform(0) == Approx(transform));
+        CHECK(instances.getColor(0) == sf::Color::Red);
+        CHECK(instances.getTransform(1) == sf::Transform::Identity);
+        CHECK(instances.getColor(1) == sf::Color::White);
+    }
+
+    SECTION("Set instance")
+    {
+        sf::InstanceBuffer instances;
+        instances.append(sf::Transform::Identity);
+        instances.setInstance(0, transform, sf::Color::Blue);
+        CHECK(instances.getInstanceCount() == 1);
+        CHECK(instances.getTransform(0) == Approx(transform));
+        CHECK(instances.getColor(0) == sf::Color::Blue);
+    }
+
+    SECTION("Clear")
+    {
+        sf::InstanceBuffer instances;
+        instances.append(transform);
+        instances.clear();
+        CHECK(instances.getInstanceCount() == 0);
+    }
+
+    SECTION("Copy")
+    {
+        sf::InstanceBuffer instances;
+        instances.append(transform, sf::Color::Green);
+
+        const sf::InstanceBuffer copy(instances); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(copy.getInstanceCount() == 1);
+        CHECK(copy.getTransform(0) == Approx(transform));
+        CHECK(copy.getColor(0) == sf::Color::Green);
+    }
+
+    SECTION("Draw")
+    {
+        // A 10x10 square, drawn as a strip so that the CPU fallback has to unroll it
+        const std::array vertices = {sf::Vertex{{0, 0}},
+                                     sf::Vertex{{0, 10}},
+                                     sf::Vertex{{10, 0}},
+                                     sf::Vertex{{10, 10}}};
+
+        sf::InstanceBuffer instances;
+        instances.append(sf::Transform().translate({20, 30}), sf::Color::Green);
+        instances.append(sf::Transform().translate({60, 30}).scale({2, 2}), sf::Color::Blue);
+
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({100, 100}));
+
+        const auto checkPixels = [&renderTexture]
+        {
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 35}) == sf::Color::Green);
+            CHECK(image.getPixel({65, 35}) == sf::Color::Blue);
+            CHECK(image.getPixel({75, 45}) == sf::Color::Blue);
+            CHECK(image.getPixel({45, 35}) == sf::Color::Red);
+            CHECK(image.getPixel({25, 60}) == sf::Color::Red);
+        };
+
+        SECTION("Vertex array")
+        {
+            renderTexture.clear(sf::Color::Red);
+            renderTexture.drawInstanced(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip, instances);
+            renderTexture.display();
+            checkPixels();
+        }
+
+        SECTION("Vertex buffer")
+        {
+            if (!sf::VertexBuffer::isAvailable())
+                return;
+
+            sf::VertexBuffer vertexBuffer(sf::PrimitiveType::TriangleStrip);
+            REQUIRE(vertexBuffer.create(vertices.size()));
+            REQUIRE(vertexBuffer.update(vertices.data()));
+
+            renderTexture.clear(sf::Color::Red);
+            renderTexture.drawInstanced(vertexBuffer, instances);
+            renderTexture.display();
+            checkPixels();
+        }
+
+        SECTION("Custom shader")
+        {
+            if (!sf::Shader::isAvailable())
+                return;
+
+            static constexpr auto fragmentSource = R"(
+void main()
+{
+    gl_FragColor = gl_Color;
+}
+)";
+
+            SECTION("With instance attributes")
+            {
+                static constexpr auto vertexSource = R"(
+attribute vec3 sf_instanceRow0;
+attribute vec3 sf_instanceRow1;
+attribute vec4 sf_instanceColor;
+
+void main()
+{
+    vec3 position = vec3(gl_Vertex.xy, 1.0);
+    gl_Position = gl_ModelViewProjectionMatrix *
+                  vec4(dot(sf_instanceRow0, position), dot(sf_instanceRow1, position), 0.0, 1.0);
+    gl_FrontColor = gl_Color * sf_instanceColor;
+}
+)";
+
+                const auto shader = sf::Shader::loadFromMemory(vertexSource, fragmentSource);
+                REQUIRE(shader);
+
+                renderTexture.clear(sf::Color::Red);
+                renderTexture.drawInstanced(vertices.data(),
+                                            vertices.size(),
+                                            sf::PrimitiveType::TriangleStrip,
+                                            instances,
+                                            &*shader);
+                renderTexture.display();
+                checkPixels();
+
+                if (sf::VertexBuffer::isAvailable())
+                {
+                    sf::VertexBuffer vertexBuffer(sf::PrimitiveType::TriangleStrip);
+                    REQUIRE(vertexBuffer.create(vertices.size()));
+                    REQUIRE(vertexBuffer.update(vertices.data()));
+
+                    renderTexture.clear(sf::Color::Red);
+                    renderTexture.drawInstanced(vertexBuffer, instances, &*shader);
+                    renderTexture.display();
+                    checkPixels();
+                }
+            }
+
+            SECTION("Without instance attributes")
+            {
+                // The instances are expanded on the CPU before reaching the shader
+                const auto shader = sf::Shader::loadFromMemory(fragmentSource, sf::Shader::Type::Fragment);
+                REQUIRE(shader);
+
+                renderTexture.clear(sf::Color::Red);
+                renderTexture.drawInstanced(vertices.data(),
+                                            vertices.size(),
+                                            sf::PrimitiveType::TriangleStrip,
+                                            instances,
+                                            &*shader);
+                renderTexture.display();
+                checkPixels();
+            }
+        }
+    }
+}
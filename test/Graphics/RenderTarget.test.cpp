@@ -1,9 +1,13 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
+// Other 1st party headers
+#include <SFML/Graphics/Drawable.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <SystemUtil.hpp>
+#include <optional>
 #include <type_traits>
 
 class RenderTarget : public sf::RenderTarget
@@ -18,6 +22,33 @@ private:
     }
 };
 
+class CullableDrawable : public sf::Drawable
+{
+public:
+    explicit CullableDrawable(std::optional<sf::FloatRect> bounds) : m_bounds(bounds)
+    {
+    }
+
+    int callCount() const
+    {
+        return m_callCount;
+    }
+
+private:
+    void draw(sf::RenderTarget&, sf::RenderStates) const override
+    {
+        ++m_callCount;
+    }
+
+    std::optional<sf::FloatRect> getCullingBounds() const override
+    {
+        return m_bounds;
+    }
+
+    std::optional<sf::FloatRect> m_bounds;
+    mutable int                  m_callCount{};
+};
+
 TEST_CASE("[Graphics] sf::RenderTarget")
 {
     SECTION("Type traits")
@@ -53,6 +84,88 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.getView().getSize() == sf::Vector2f(3, 4));
     }
 
+    SECTION("Set/get culling enabled")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isCullingEnabled());
+        renderTarget.setCullingEnabled(true);
+        CHECK(renderTarget.isCullingEnabled());
+        renderTarget.setCullingEnabled(false);
+        CHECK(!renderTarget.isCullingEnabled());
+    }
+
+    SECTION("Culling")
+    {
+        RenderTarget           renderTarget;
+        const CullableDrawable visible(sf::FloatRect({100, 100}, {50, 50}));
+        const CullableDrawable outside(sf::FloatRect({2000, 100}, {50, 50}));
+        const CullableDrawable unbounded(std::nullopt);
+
+        SECTION("Disabled")
+        {
+            renderTarget.draw(visible);
+            renderTarget.draw(outside);
+            CHECK(visible.callCount() == 1);
+            CHECK(outside.callCount() == 1);
+            CHECK(renderTarget.getCullingStatistics().submitted == 0);
+            CHECK(renderTarget.getCullingStatistics().culled == 0);
+        }
+
+        SECTION("Enabled")
+        {
+            renderTarget.setCullingEnabled(true);
+            renderTarget.draw(visible);
+            renderTarget.draw(outside);
+            renderTarget.draw(unbounded);
+            CHECK(visible.callCount() == 1);
+            CHECK(outside.callCount() == 0);
+            CHECK(unbounded.callCount() == 1);
+            CHECK(renderTarget.getCullingStatistics().submitted == 1);
+            CHECK(renderTarget.getCullingStatistics().culled == 1);
+        }
+
+        SECTION("Render states transform")
+        {
+            renderTarget.setCullingEnabled(true);
+            renderTarget.draw(visible, sf::Transform().translate({2000, 0}));
+            renderTarget.draw(outside, sf::Transform().translate({-1900, 0}));
+            CHECK(visible.callCount() == 0);
+            CHECK(outside.callCount() == 1);
+        }
+
+        SECTION("Rotated view")
+        {
+            renderTarget.setCullingEnabled(true);
+            sf::View view({0, 0}, {100, 100});
+            view.setRotation(sf::degrees(45));
+            renderTarget.setView(view);
+
+            // The corners of the rotated view reach 70.7 units away from its center along the axes
+            const CullableDrawable corner(sf::FloatRect({60, -5}, {5, 10}));
+            const CullableDrawable beyond(sf::FloatRect({85, -5}, {5, 10}));
+            renderTarget.draw(corner);
+            renderTarget.draw(beyond);
+            CHECK(corner.callCount() == 1);
+            CHECK(beyond.callCount() == 0);
+        }
+
+        SECTION("Viewport and scissor")
+        {
+            renderTarget.setCullingEnabled(true);
+            sf::View view({500, 500}, {1000, 1000});
+            view.setViewport(sf::FloatRect({0.5f, 0}, {0.5f, 1}));
+            view.setScissor(sf::FloatRect({0.5f, 0}, {0.25f, 1}));
+            renderTarget.setView(view);
+
+            const CullableDrawable leftHalf(sf::FloatRect({100, 100}, {50, 50}));
+            const CullableDrawable rightHalf(sf::FloatRect({800, 100}, {50, 50}));
+            renderTarget.draw(leftHalf);
+            renderTarget.draw(rightHalf);
+            CHECK(leftHalf.callCount() == 1);
+            CHECK(rightHalf.callCount() == 0);
+        }
+    }
+
     SECTION("setActive()")
     {
         RenderTarget renderTarget;
@@ -1,9 +1,17 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <array>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
 {
@@ -80,4 +88,50 @@ TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
         CHECK(renderTexture.create({480, 360}));
         CHECK(renderTexture.getTexture().getSize() == sf::Vector2u(480, 360));
     }
+
+    SECTION("Draw from multiple threads")
+    {
+        // Each thread alternates between two render textures so that
+        // the active render target of its context keeps changing
+        constexpr std::size_t         threadCount = 4;
+        std::array<bool, threadCount> results{};
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                [&result = results[i]]
+                {
+                    std::array<sf::RenderTexture, 2> renderTextures;
+                    for (auto& renderTexture : renderTextures)
+                    {
+                        if (!renderTexture.create({16, 16}))
+                            return;
+                        renderTexture.clear(sf::Color::Red);
+                    }
+
+                    sf::RectangleShape shape({1, 1});
+                    shape.setFillColor(sf::Color::Green);
+                    for (unsigned int j = 0; j < 1000; ++j)
+                    {
+                        shape.setPosition({static_cast<float>(j % 16), static_cast<float>(j / 16 % 16)});
+                        renderTextures[(j / 100) % 2].draw(shape);
+                    }
+
+                    result = true;
+                    for (auto& renderTexture : renderTextures)
+                    {
+                        renderTexture.display();
+                        const sf::Image image = renderTexture.getTexture().copyToImage();
+                        result                = result && (image.getPixel({5, 5}) == sf::Color::Green);
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const bool result : results)
+            CHECK(result);
+    }
 }
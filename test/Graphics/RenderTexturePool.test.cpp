@@ -0,0 +1,133 @@
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::RenderTexturePool", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::RenderTexturePool>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::RenderTexturePool>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::RenderTexturePool pool;
+            CHECK(pool.getBucketSize() == 1);
+            CHECK(pool.getInUseCount() == 0);
+            CHECK(pool.getAvailableCount() == 0);
+            CHECK(pool.getStatistics().created == 0);
+            CHECK(pool.getStatistics().reused == 0);
+        }
+
+        SECTION("Bucket size constructor")
+        {
+            CHECK(sf::RenderTexturePool(64).getBucketSize() == 64);
+            CHECK(sf::RenderTexturePool(0).getBucketSize() == 1);
+        }
+    }
+
+    SECTION("acquire() and recycle()")
+    {
+        sf::RenderTexturePool pool;
+
+        sf::RenderTexture* first = pool.acquire({100, 50});
+        REQUIRE(first != nullptr);
+        CHECK(first->getSize() == sf::Vector2u(100, 50));
+        CHECK(pool.getInUseCount() == 1);
+        CHECK(pool.getStatistics().created == 1);
+
+        // A render texture in use is never handed out twice
+        sf::RenderTexture* second = pool.acquire({100, 50});
+        REQUIRE(second != nullptr);
+        CHECK(second != first);
+        CHECK(pool.getInUseCount() == 2);
+        CHECK(pool.getStatistics().created == 2);
+
+        pool.recycle(*first);
+        pool.recycle(*second);
+        CHECK(pool.getInUseCount() == 0);
+        CHECK(pool.getAvailableCount() == 2);
+
+        SECTION("Same size and settings")
+        {
+            first->setSmooth(true);
+            sf::RenderTexture* reused = pool.acquire({100, 50});
+            CHECK((reused == first || reused == second));
+            CHECK(!reused->isSmooth());
+            CHECK(pool.getStatistics().created == 2);
+            CHECK(pool.getStatistics().reused == 1);
+        }
+
+        SECTION("Different size")
+        {
+            sf::RenderTexture* other = pool.acquire({50, 100});
+            REQUIRE(other != nullptr);
+            CHECK(other->getSize() == sf::Vector2u(50, 100));
+            CHECK(pool.getStatistics().created == 3);
+            CHECK(pool.getStatistics().reused == 0);
+        }
+
+        SECTION("Different settings")
+        {
+            sf::ContextSettings settings;
+            settings.depthBits = 24;
+            sf::RenderTexture* other = pool.acquire({100, 50}, settings);
+            REQUIRE(other != nullptr);
+            CHECK(pool.getStatistics().created == 3);
+            CHECK(pool.getStatistics().reused == 0);
+        }
+
+        SECTION("releaseUnused()")
+        {
+            sf::RenderTexture* inUse = pool.acquire({100, 50});
+            REQUIRE(inUse != nullptr);
+            pool.releaseUnused();
+            CHECK(pool.getInUseCount() == 1);
+            CHECK(pool.getAvailableCount() == 0);
+        }
+    }
+
+    SECTION("Size buckets")
+    {
+        sf::RenderTexturePool pool(64);
+
+        sf::RenderTexture* renderTexture = pool.acquire({100, 50});
+        REQUIRE(renderTexture != nullptr);
+        CHECK(renderTexture->getSize() == sf::Vector2u(128, 64));
+        CHECK(renderTexture->getView().getSize() == sf::Vector2f(100, 50));
+        CHECK(renderTexture->getView().getViewport() == sf::FloatRect({0, 0}, {100.f / 128.f, 50.f / 64.f}));
+        pool.recycle(*renderTexture);
+
+        CHECK(pool.acquire({120, 60}) == renderTexture);
+        CHECK(renderTexture->getView().getSize() == sf::Vector2f(120, 60));
+        CHECK(pool.getStatistics().created == 1);
+        CHECK(pool.getStatistics().reused == 1);
+
+        // The requested area maps to the top-left corner of the texture
+        sf::RectangleShape shape(sf::Vector2f(120, 60));
+        shape.setFillColor(sf::Color::Green);
+        renderTexture->clear(sf::Color::Red);
+        renderTexture->draw(shape);
+        renderTexture->display();
+
+        const sf::Image image = renderTexture->getTexture().copyToImage();
+        CHECK(image.getPixel({0, 0}) == sf::Color::Green);
+        CHECK(image.getPixel({119, 59}) == sf::Color::Green);
+        CHECK(image.getPixel({125, 10}) == sf::Color::Red);
+        CHECK(image.getPixel({10, 62}) == sf::Color::Red);
+    }
+}
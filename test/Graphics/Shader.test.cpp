@@ -1,11 +1,18 @@
 #include <SFML/Graphics/Shader.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
 #include <SFML/System/FileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <GraphicsUtil.hpp>
+#include <filesystem>
 #include <type_traits>
+#include <utility>
 
 namespace
 {
@@ -241,6 +248,79 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
             CHECK(static_cast<bool>(shader->getNativeHandle()) == sf::Shader::isAvailable());
     }
 
+    SECTION("getUniformHandle()")
+    {
+        static constexpr auto colorSource = R"(
+uniform vec4 color;
+
+void main()
+{
+    gl_FragColor = color;
+}
+)";
+
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({4, 4}));
+
+        auto shader = sf::Shader::loadFromMemory(colorSource, sf::Shader::Type::Fragment);
+        REQUIRE(shader);
+
+        CHECK(!shader->getUniformHandle("does_not_exist"));
+
+        const auto color = shader->getUniformHandle("color");
+        REQUIRE(color);
+
+        // The quad is drawn white, only the uniform can give it another color
+        const auto render = [&renderTexture](const sf::Shader& renderShader)
+        {
+            renderTexture.clear(sf::Color::Blue);
+            renderTexture.draw(sf::RectangleShape({4, 4}), sf::RenderStates(&renderShader));
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage().getPixel({1, 1});
+        };
+
+        shader->setUniform(*color, sf::Glsl::Vec4(sf::Color::Red));
+        CHECK(render(*shader) == sf::Color::Red);
+
+        // A value set by name afterwards replaces the one staged through the handle
+        shader->setUniform(*color, sf::Glsl::Vec4(sf::Color::Yellow));
+        shader->setUniform("color", sf::Glsl::Vec4(sf::Color::Green));
+        CHECK(render(*shader) == sf::Color::Green);
+
+        // Handles stay valid when the shader is moved
+        sf::Shader movedShader = std::move(*shader);
+        movedShader.setUniform(*color, sf::Glsl::Vec4(sf::Color::Magenta));
+        CHECK(render(movedShader) == sf::Color::Magenta);
+    }
+
+    SECTION("Program binary cache")
+    {
+        const auto directory = std::filesystem::temp_directory_path() / "sfml-shader-cache-test";
+        std::filesystem::remove_all(directory);
+
+        CHECK(sf::Shader::getProgramCacheDirectory().empty());
+        sf::Shader::setProgramCacheDirectory(directory);
+        CHECK(sf::Shader::getProgramCacheDirectory() == directory);
+
+        const auto before = sf::Shader::getProgramCacheStatistics();
+        CHECK(sf::Shader::loadFromMemory(vertexSource, fragmentSource).has_value() == sf::Shader::isAvailable());
+        const auto afterFirstLoad = sf::Shader::getProgramCacheStatistics();
+        CHECK(sf::Shader::loadFromMemory(vertexSource, fragmentSource).has_value() == sf::Shader::isAvailable());
+        const auto afterSecondLoad = sf::Shader::getProgramCacheStatistics();
+
+        // When the driver supports program binaries, the first load fills the cache and the second one uses it
+        CHECK(afterFirstLoad.hits == before.hits);
+        if (afterFirstLoad.misses > before.misses)
+        {
+            CHECK(afterSecondLoad.hits == afterFirstLoad.hits + 1);
+            CHECK(afterSecondLoad.misses == afterFirstLoad.misses);
+        }
+
+        sf::Shader::setProgramCacheDirectory({});
+        CHECK(sf::Shader::getProgramCacheDirectory().empty());
+        std::filesystem::remove_all(directory);
+    }
+
     SECTION("loadFromStream()")
     {
         sf::FileInputStream vertexShaderStream;
@@ -0,0 +1,152 @@
+#include <SFML/Graphics/SpriteBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::SpriteBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SpriteBatch>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::SpriteBatch spriteBatch;
+            CHECK(spriteBatch.getFlushPolicy() == sf::SpriteBatch::FlushPolicy::Ordered);
+            CHECK(spriteBatch.getQuadCount() == 0);
+            CHECK(spriteBatch.getBatchCount() == 0);
+        }
+
+        SECTION("Flush policy constructor")
+        {
+            const sf::SpriteBatch spriteBatch(sf::SpriteBatch::FlushPolicy::ByState);
+            CHECK(spriteBatch.getFlushPolicy() == sf::SpriteBatch::FlushPolicy::ByState);
+            CHECK(spriteBatch.getQuadCount() == 0);
+            CHECK(spriteBatch.getBatchCount() == 0);
+        }
+    }
+
+    SECTION("Set/get flush policy")
+    {
+        sf::SpriteBatch spriteBatch;
+        spriteBatch.setFlushPolicy(sf::SpriteBatch::FlushPolicy::ByState);
+        CHECK(spriteBatch.getFlushPolicy() == sf::SpriteBatch::FlushPolicy::ByState);
+    }
+
+    const sf::Texture texture1;
+    const sf::Texture texture2;
+    const sf::Sprite  sprite1(texture1, {{0, 0}, {10, 10}});
+    const sf::Sprite  sprite2(texture2, {{0, 0}, {10, 10}});
+
+    SECTION("Append")
+    {
+        SECTION("Ordered")
+        {
+            sf::SpriteBatch spriteBatch(sf::SpriteBatch::FlushPolicy::Ordered);
+            spriteBatch.append(sprite1);
+            spriteBatch.append(sprite1);
+            CHECK(spriteBatch.getQuadCount() == 2);
+            CHECK(spriteBatch.getBatchCount() == 1);
+
+            spriteBatch.append(sprite2);
+            spriteBatch.append(sprite1);
+            CHECK(spriteBatch.getQuadCount() == 4);
+            CHECK(spriteBatch.getBatchCount() == 3);
+        }
+
+        SECTION("By state")
+        {
+            sf::SpriteBatch spriteBatch(sf::SpriteBatch::FlushPolicy::ByState);
+            spriteBatch.append(sprite1);
+            spriteBatch.append(sprite2);
+            spriteBatch.append(sprite1);
+            spriteBatch.append(sprite2);
+            CHECK(spriteBatch.getQuadCount() == 4);
+            CHECK(spriteBatch.getBatchCount() == 2);
+        }
+
+        SECTION("Different blend modes")
+        {
+            sf::SpriteBatch spriteBatch;
+            spriteBatch.append(sprite1, sf::BlendAlpha);
+            spriteBatch.append(sprite1, sf::BlendAdd);
+            CHECK(spriteBatch.getQuadCount() == 2);
+            CHECK(spriteBatch.getBatchCount() == 2);
+        }
+
+        SECTION("Different transforms")
+        {
+            sf::SpriteBatch spriteBatch;
+            spriteBatch.append(sprite1, sf::Transform().translate({10, 0}));
+            spriteBatch.append(sprite1, sf::Transform().rotate(sf::degrees(45)));
+            CHECK(spriteBatch.getQuadCount() == 2);
+            CHECK(spriteBatch.getBatchCount() == 1);
+        }
+
+        SECTION("Quad")
+        {
+            const sf::Vertex quad[] = {{{0, 0}}, {{0, 10}}, {{10, 0}}, {{10, 10}}};
+
+            sf::SpriteBatch spriteBatch;
+            spriteBatch.append(quad);
+            spriteBatch.append(quad, &texture1);
+            spriteBatch.append(quad, &texture1);
+            CHECK(spriteBatch.getQuadCount() == 3);
+            CHECK(spriteBatch.getBatchCount() == 2);
+        }
+    }
+
+    SECTION("Clear")
+    {
+        sf::SpriteBatch spriteBatch;
+        spriteBatch.append(sprite1);
+        spriteBatch.append(sprite2);
+        spriteBatch.clear();
+        CHECK(spriteBatch.getQuadCount() == 0);
+        CHECK(spriteBatch.getBatchCount() == 0);
+
+        spriteBatch.append(sprite2);
+        CHECK(spriteBatch.getQuadCount() == 1);
+        CHECK(spriteBatch.getBatchCount() == 1);
+    }
+
+    SECTION("Draw")
+    {
+        sf::Texture texture;
+        REQUIRE(texture.loadFromImage(sf::Image({10, 10}, sf::Color::Green)));
+
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({100, 100}));
+        renderTexture.clear(sf::Color::Red);
+
+        sf::Sprite sprite(texture);
+        sprite.setPosition({20, 30});
+
+        sf::SpriteBatch spriteBatch;
+        spriteBatch.append(sprite);
+        spriteBatch.append(sprite, sf::Transform().translate({50, 0}));
+        renderTexture.draw(spriteBatch);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 35}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 35}) == sf::Color::Green);
+        CHECK(image.getPixel({50, 35}) == sf::Color::Red);
+        CHECK(image.getPixel({25, 60}) == sf::Color::Red);
+    }
+}
@@ -2,13 +2,19 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
+#include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <algorithm>
 #include <type_traits>
 
+#include <cstddef>
+
 TEST_CASE("[Graphics] sf::Text", runDisplayTests())
 {
     SECTION("Type traits")
@@ -36,6 +42,7 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
             CHECK(text.getFillColor() == sf::Color::White);
             CHECK(text.getOutlineColor() == sf::Color::Black);
             CHECK(text.getOutlineThickness() == 0);
+            CHECK(text.getRenderMode() == sf::Text::RenderMode::Bitmap);
             CHECK(text.findCharacterPos(0) == sf::Vector2f());
             CHECK(text.getLocalBounds() == sf::FloatRect());
             CHECK(text.getGlobalBounds() == sf::FloatRect());
@@ -140,6 +147,13 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getOutlineThickness() == 3.14f);
     }
 
+    SECTION("Set/get render mode")
+    {
+        sf::Text text(font);
+        text.setRenderMode(sf::Text::RenderMode::DistanceField);
+        CHECK(text.getRenderMode() == sf::Text::RenderMode::DistanceField);
+    }
+
     SECTION("findCharacterPos()")
     {
         sf::Text text(font, "\tabcdefghijklmnopqrstuvwxyz \n");
@@ -175,11 +189,110 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
             CHECK(text.getGlobalBounds() == sf::FloatRect({101, 205}, {33, 13}));
         }
 
+        SECTION("Append characters")
+        {
+            text.setStyle(sf::Text::Underlined | sf::Text::StrikeThrough);
+            text.setOutlineThickness(2);
+            CHECK(text.getLocalBounds() == sf::FloatRect({-1, 3}, {37, 17}));
+
+            const auto render = [](const sf::Text& renderedText)
+            {
+                sf::RenderTexture renderTexture;
+                REQUIRE(renderTexture.create({300, 300}));
+                renderTexture.clear();
+                renderTexture.draw(renderedText);
+                renderTexture.display();
+                return renderTexture.getTexture().copyToImage();
+            };
+
+            // Only the new characters are laid out, the result must match a full layout
+            text.setString("Test\nTest again");
+            const sf::Image appendedImage = render(text);
+
+            sf::Text fullText(font, "Test\nTest again", 18);
+            fullText.setStyle(sf::Text::Underlined | sf::Text::StrikeThrough);
+            fullText.setOutlineThickness(2);
+            fullText.setPosition(text.getPosition());
+            const sf::Image fullImage = render(fullText);
+
+            CHECK(text.getLocalBounds() == fullText.getLocalBounds());
+            CHECK(text.findCharacterPos(15) == fullText.findCharacterPos(15));
+
+            // Identical pixels mean that the appended quads match the ones of the full layout
+            const std::size_t byteCount = std::size_t{appendedImage.getSize().x} * appendedImage.getSize().y * 4;
+            CHECK(std::equal(appendedImage.getPixelsPtr(),
+                             appendedImage.getPixelsPtr() + byteCount,
+                             fullImage.getPixelsPtr()));
+        }
+
         SECTION("Change rotation")
         {
             text.setRotation(sf::degrees(180));
             CHECK(text.getLocalBounds() == sf::FloatRect({1, 5}, {33, 13}));
             CHECK(text.getGlobalBounds() == Approx(sf::FloatRect({66, 182}, {33, 13})));
         }
+
+        SECTION("Distance field")
+        {
+            // Distance field glyphs are scaled from another size, so metrics only match roughly
+            text.setRenderMode(sf::Text::RenderMode::DistanceField);
+            const sf::FloatRect bounds = text.getLocalBounds();
+            CHECK(bounds.left == Catch::Approx(1.f).margin(1));
+            CHECK(bounds.top == Catch::Approx(5.f).margin(1));
+            CHECK(bounds.width == Catch::Approx(33.f).margin(2));
+            CHECK(bounds.height == Catch::Approx(13.f).margin(1));
+        }
+    }
+
+    SECTION("Atlas too small for the text")
+    {
+        // At this size the capped atlas holds only a few glyphs, so laying
+        // the text out always evicts some of its own glyphs
+        auto cappedFont = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        cappedFont.setMaximumAtlasSize(128);
+
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({200, 100}));
+
+        // Each retry has to evict fewer glyphs than the previous one, so
+        // there can't be more retries than glyphs in the text
+        const sf::Text text(cappedFont, "abcdefghijklmnopqrstuvwxyz", 60);
+        for (int i = 0; i < 30; ++i)
+            renderTexture.draw(text);
+        const std::size_t evictionCount = cappedFont.getAtlasStats(60).evictionCount;
+        CHECK(evictionCount > 0);
+
+        // Once retrying stops making progress, the text stops laying itself out again
+        renderTexture.draw(text);
+        renderTexture.draw(text);
+        CHECK(cappedFont.getAtlasStats(60).evictionCount == evictionCount);
+    }
+
+    SECTION("Distance field rendering")
+    {
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({200, 100}));
+
+        sf::Text text(font, "AVAWAY Test", 30);
+        text.setRenderMode(sf::Text::RenderMode::DistanceField);
+        renderTexture.clear();
+        renderTexture.draw(text);
+        renderTexture.display();
+        CHECK(text.findCharacterPos(3).x > text.findCharacterPos(2).x);
+
+        // Kerning is computed from the distance field glyphs, so no regular glyph
+        // gets rasterized at the distance field size
+        const sf::Image atlas = font.getTexture(font.getDistanceFieldSize()).copyToImage();
+        bool            empty = true;
+        for (unsigned int y = 0; y < atlas.getSize().y; ++y)
+        {
+            for (unsigned int x = 0; x < atlas.getSize().x; ++x)
+            {
+                // Skip the white square reserved for underlines
+                if ((x >= 2 || y >= 2) && atlas.getPixel({x, y}).a != 0)
+                    empty = false;
+            }
+        }
+        CHECK(empty);
     }
 }
@@ -0,0 +1,123 @@
+#include <SFML/Graphics/TextureStreamer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextureStreamer", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureStreamer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureStreamer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::TextureStreamer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::TextureStreamer>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TextureStreamer textureStreamer;
+        CHECK(textureStreamer.getPendingReadbackCount() == 0);
+    }
+
+    sf::TextureStreamer textureStreamer;
+
+    SECTION("update()")
+    {
+        sf::Texture texture;
+        REQUIRE(texture.create({2, 1}));
+
+        SECTION("Pixels")
+        {
+            constexpr std::array<std::uint8_t, 4> yellow = {0xFF, 0xFF, 0x00, 0xFF};
+            constexpr std::array<std::uint8_t, 4> cyan   = {0x00, 0xFF, 0xFF, 0xFF};
+            textureStreamer.update(texture, yellow.data(), {1, 1}, {0, 0});
+            textureStreamer.update(texture, cyan.data(), {1, 1}, {1, 0});
+            CHECK(texture.copyToImage().getPixel({0, 0}) == sf::Color::Yellow);
+            CHECK(texture.copyToImage().getPixel({1, 0}) == sf::Color::Cyan);
+        }
+
+        SECTION("Image")
+        {
+            // Cycle through more updates than there are upload buffers
+            for (const sf::Color color : {sf::Color::Red, sf::Color::Green, sf::Color::Blue, sf::Color::Magenta})
+                textureStreamer.update(texture, sf::Image({2, 1}, color));
+
+            CHECK(texture.copyToImage().getPixel({0, 0}) == sf::Color::Magenta);
+            CHECK(texture.copyToImage().getPixel({1, 0}) == sf::Color::Magenta);
+        }
+    }
+
+    SECTION("Readback")
+    {
+        SECTION("No pending readback")
+        {
+            CHECK(!textureStreamer.pollReadback());
+            CHECK(!textureStreamer.waitReadback());
+        }
+
+        SECTION("Texture")
+        {
+            sf::Image image({2, 3}, sf::Color::Red);
+            image.setPixel({1, 2}, sf::Color::Green);
+
+            sf::Texture texture;
+            REQUIRE(texture.loadFromImage(image));
+
+            textureStreamer.requestReadback(texture);
+            CHECK(textureStreamer.getPendingReadbackCount() == 1);
+
+            // The readback holds the contents at the time of the request
+            texture.update(sf::Image({2, 3}, sf::Color::Blue));
+            textureStreamer.requestReadback(texture);
+            CHECK(textureStreamer.getPendingReadbackCount() == 2);
+
+            const auto first = textureStreamer.waitReadback();
+            REQUIRE(first);
+            CHECK(first->getSize() == sf::Vector2u(2, 3));
+            CHECK(first->getPixel({0, 0}) == sf::Color::Red);
+            CHECK(first->getPixel({1, 2}) == sf::Color::Green);
+
+            const auto second = textureStreamer.waitReadback();
+            REQUIRE(second);
+            CHECK(second->getPixel({1, 2}) == sf::Color::Blue);
+            CHECK(textureStreamer.getPendingReadbackCount() == 0);
+        }
+
+        SECTION("Flipped texture")
+        {
+            sf::RenderTexture renderTexture;
+            REQUIRE(renderTexture.create({4, 4}));
+            renderTexture.clear(sf::Color::Cyan);
+
+            // Only the top row is red, so that a readback missing the y-flip puts it at the bottom
+            sf::RectangleShape topRow({4, 1});
+            topRow.setFillColor(sf::Color::Red);
+            renderTexture.draw(topRow);
+            renderTexture.display();
+
+            textureStreamer.requestReadback(renderTexture.getTexture());
+
+            std::optional<sf::Image> image;
+            while (!image)
+                image = textureStreamer.pollReadback();
+
+            CHECK(image->getSize() == sf::Vector2u(4, 4));
+            CHECK(image->getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image->getPixel({3, 0}) == sf::Color::Red);
+            CHECK(image->getPixel({0, 1}) == sf::Color::Cyan);
+            CHECK(image->getPixel({0, 3}) == sf::Color::Cyan);
+            CHECK(image->getPixel({3, 3}) == sf::Color::Cyan);
+            CHECK(textureStreamer.getPendingReadbackCount() == 0);
+        }
+    }
+}
@@ -1,5 +1,8 @@
 #include <SFML/Graphics/Transform.hpp>
 
+// Other 1st party headers
+#include <SFML/Graphics/Vertex.hpp>
+
 #include <SFML/System/Angle.hpp>
 
 #include <catch2/catch_test_macros.hpp>
@@ -86,6 +89,59 @@ TEST_CASE("[Graphics] sf::Transform")
                      sf::FloatRect({303.0f, 904.0f}, {600.0f, 1800.0f}));
     }
 
+    SECTION("transformPoints()")
+    {
+        sf::Transform transform;
+        transform.translate({3.0f, 4.0f}).rotate(sf::degrees(30)).scale({2.0f, -1.0f});
+
+        // Use a count that exercises both the batched and the remaining points
+        std::vector<sf::Vector2f> points;
+        for (int i = 0; i < 11; ++i)
+            points.emplace_back(static_cast<float>(i) * 1.5f, static_cast<float>(i) - 7.0f);
+
+        SECTION("Separate output")
+        {
+            std::vector<sf::Vector2f> output(points.size());
+            transform.transformPoints(points.data(), output.data(), points.size());
+            for (std::size_t i = 0; i < points.size(); ++i)
+                CHECK(output[i] == Approx(transform.transformPoint(points[i])));
+        }
+
+        SECTION("In place")
+        {
+            std::vector<sf::Vector2f> output = points;
+            transform.transformPoints(output.data(), output.data(), output.size());
+            for (std::size_t i = 0; i < points.size(); ++i)
+                CHECK(output[i] == Approx(transform.transformPoint(points[i])));
+        }
+
+        SECTION("Empty range")
+        {
+            transform.transformPoints(nullptr, nullptr, 0);
+        }
+    }
+
+    SECTION("transformVertices()")
+    {
+        sf::Transform transform;
+        transform.translate({3.0f, 4.0f}).rotate(sf::degrees(30)).scale({2.0f, -1.0f});
+
+        std::vector<sf::Vertex> vertices;
+        for (int i = 0; i < 11; ++i)
+            vertices.push_back({{static_cast<float>(i) * 1.5f, static_cast<float>(i) - 7.0f},
+                                sf::Color::Red,
+                                {static_cast<float>(i), 1.0f}});
+
+        std::vector<sf::Vertex> output = vertices;
+        transform.transformVertices(output.data(), output.size());
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            CHECK(output[i].position == Approx(transform.transformPoint(vertices[i].position)));
+            CHECK(output[i].color == vertices[i].color);
+            CHECK(output[i].texCoords == vertices[i].texCoords);
+        }
+    }
+
     SECTION("combine()")
     {
         auto identity = sf::Transform::Identity;
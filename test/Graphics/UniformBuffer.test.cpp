@@ -0,0 +1,118 @@
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+#include <utility>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::UniformBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UniformBuffer>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.getSize() == 0);
+        CHECK(uniformBuffer.getNativeHandle() == 0);
+    }
+
+    // Skip tests if uniform buffers aren't available
+    if (!sf::UniformBuffer::isAvailable())
+        return;
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() != 0);
+    }
+
+    SECTION("update()")
+    {
+        const std::array<float, 8> data{};
+
+        sf::UniformBuffer uniformBuffer;
+        CHECK(!uniformBuffer.update(data.data(), sizeof(data)));
+
+        REQUIRE(uniformBuffer.create(sizeof(data)));
+        CHECK(uniformBuffer.update(data.data(), sizeof(data)));
+        CHECK(uniformBuffer.update(data.data(), sizeof(float) * 4, sizeof(float) * 4));
+        CHECK(!uniformBuffer.update(data.data(), sizeof(data), sizeof(float)));
+        CHECK(!uniformBuffer.update(nullptr, sizeof(data)));
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::UniformBuffer movedUniformBuffer;
+        REQUIRE(movedUniformBuffer.create(16));
+        const unsigned int handle = movedUniformBuffer.getNativeHandle();
+
+        const sf::UniformBuffer uniformBuffer = std::move(movedUniformBuffer);
+        CHECK(uniformBuffer.getSize() == 16);
+        CHECK(uniformBuffer.getNativeHandle() == handle);
+    }
+
+    SECTION("Shader::bindUniformBlock()")
+    {
+        static constexpr auto fragmentSource = R"(
+#version 140
+
+layout(std140) uniform Frame
+{
+    vec4 color;
+};
+
+void main()
+{
+    gl_FragColor = color;
+}
+)";
+
+        // GLSL 1.40 is guaranteed from OpenGL 3.1 on, older contexts may only expose the extension
+        {
+            const sf::Context context;
+            const auto&       settings = context.getSettings();
+            if (settings.majorVersion < 3 || (settings.majorVersion == 3 && settings.minorVersion < 1))
+                SKIP("GLSL 1.40 is not available");
+        }
+
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({4, 4}));
+
+        auto shader = sf::Shader::loadFromMemory(fragmentSource, sf::Shader::Type::Fragment);
+        REQUIRE(shader);
+
+        const std::array color = {1.f, 0.f, 0.f, 1.f};
+
+        sf::UniformBuffer uniformBuffer;
+        REQUIRE(uniformBuffer.create(sizeof(color)));
+        REQUIRE(uniformBuffer.update(color.data(), sizeof(color)));
+
+        shader->bindUniformBlock("Frame", uniformBuffer);
+        shader->bindUniformBlock("DoesNotExist", uniformBuffer);
+
+        // The quad is drawn white, only the uniform block can make it red
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.draw(sf::RectangleShape({4, 4}), sf::RenderStates(&*shader));
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({1, 1}) == sf::Color::Red);
+    }
+}
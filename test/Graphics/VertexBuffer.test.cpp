@@ -1,6 +1,9 @@
 #include <SFML/Graphics/VertexBuffer.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 
 #include <catch2/catch_test_macros.hpp>
@@ -144,6 +147,55 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         }
     }
 
+    SECTION("map()")
+    {
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::TriangleStrip);
+        CHECK(vertexBuffer.map(0) == nullptr);
+
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({10, 10}));
+
+        // Cycle through more frames than there are regions in the buffer
+        for (const sf::Color color : {sf::Color::Red, sf::Color::Green, sf::Color::Blue, sf::Color::Yellow})
+        {
+            sf::Vertex* vertices = vertexBuffer.map(4);
+            REQUIRE(vertices != nullptr);
+            vertices[0] = {{0, 0}, color};
+            vertices[1] = {{0, 10}, color};
+            vertices[2] = {{10, 0}, color};
+            vertices[3] = {{10, 10}, color};
+            REQUIRE(vertexBuffer.unmap());
+            CHECK(vertexBuffer.getVertexCount() == 4);
+            CHECK(vertexBuffer.getNativeHandle() != 0);
+
+            renderTexture.clear();
+            renderTexture.draw(vertexBuffer);
+            renderTexture.display();
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({5, 5}) == color);
+        }
+
+        SECTION("Grow")
+        {
+            REQUIRE(vertexBuffer.map(1000) != nullptr);
+            CHECK(vertexBuffer.unmap());
+            CHECK(vertexBuffer.getVertexCount() == 1000);
+        }
+
+        SECTION("Update after map")
+        {
+            const std::array<sf::Vertex, 4> vertices = {sf::Vertex{{0, 0}, sf::Color::Cyan},
+                                                        sf::Vertex{{0, 10}, sf::Color::Cyan},
+                                                        sf::Vertex{{10, 0}, sf::Color::Cyan},
+                                                        sf::Vertex{{10, 10}, sf::Color::Cyan}};
+            CHECK(vertexBuffer.update(vertices.data()));
+
+            renderTexture.clear();
+            renderTexture.draw(vertexBuffer);
+            renderTexture.display();
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({5, 5}) == sf::Color::Cyan);
+        }
+    }
+
     SECTION("swap()")
     {
         sf::VertexBuffer vertexBuffer1(sf::PrimitiveType::LineStrip, sf::VertexBuffer::Usage::Dynamic);
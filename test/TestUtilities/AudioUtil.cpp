@@ -1,5 +1,88 @@
 #include <AudioUtil.hpp>
 
+// Other 1st party headers
+#include <SFML/Audio/TestHooks.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace
+{
+thread_local bool        isAudioThread{};
+std::atomic<bool>        trackingEnabled{};
+std::atomic<std::size_t> audioThreadAllocationCount{};
+
+void countAllocation()
+{
+    if (isAudioThread && trackingEnabled)
+        ++audioThreadAllocationCount;
+}
+
+void* allocate(std::size_t size) noexcept
+{
+    countAllocation();
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t alignment) noexcept
+{
+    countAllocation();
+    const auto alignmentValue = static_cast<std::size_t>(alignment);
+    // Round up, std::aligned_alloc requires the size to be a multiple of the alignment
+    const auto alignedSize = (std::max<std::size_t>(size, 1) + alignmentValue - 1) / alignmentValue * alignmentValue;
+#ifdef _WIN32
+    return _aligned_malloc(alignedSize, alignmentValue);
+#else
+    return std::aligned_alloc(alignmentValue, alignedSize);
+#endif
+}
+
+void deallocateAligned(void* pointer) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+void* miniaudioMalloc(std::size_t size, void* /* userData */)
+{
+    countAllocation();
+    return std::malloc(size);
+}
+
+void* miniaudioRealloc(void* pointer, std::size_t size, void* /* userData */)
+{
+    countAllocation();
+    return std::realloc(pointer, size);
+}
+
+void miniaudioFree(void* pointer, void* /* userData */)
+{
+    std::free(pointer);
+}
+
+// miniaudio uses its own allocator, the tests pass it counting callbacks to observe its allocations
+constexpr ma_allocation_callbacks miniaudioAllocationCallbacks{nullptr,
+                                                               miniaudioMalloc,
+                                                               miniaudioRealloc,
+                                                               miniaudioFree};
+
+[[maybe_unused]] const bool miniaudioAllocationCallbacksInstalled = []
+{
+    sf::priv::TestHooks::setAllocationCallbacks(&miniaudioAllocationCallbacks);
+    return true;
+}();
+} // namespace
+
 std::string runAudioDeviceTests()
 {
 #ifdef SFML_RUN_AUDIO_DEVICE_TESTS
@@ -10,3 +93,139 @@ std::string runAudioDeviceTests()
     return "[.audio_device]";
 #endif
 }
+
+NullAudioBackend::NullAudioBackend() : m_previouslyForced(sf::priv::TestHooks::isNullBackendForced())
+{
+    sf::priv::TestHooks::setNullBackendForced(true);
+}
+
+NullAudioBackend::~NullAudioBackend()
+{
+    sf::priv::TestHooks::setNullBackendForced(m_previouslyForced);
+}
+
+void markAudioThread()
+{
+    isAudioThread = true;
+}
+
+void startAudioThreadAllocationTracking()
+{
+    audioThreadAllocationCount = 0;
+    trackingEnabled            = true;
+}
+
+std::size_t stopAudioThreadAllocationTracking()
+{
+    trackingEnabled = false;
+    return audioThreadAllocationCount;
+}
+
+// Replacing the global allocation functions affects the whole test executable (and the
+// SFML libraries it links, except for DLLs on Windows which keep their own allocator).
+// miniaudio's allocations are counted through the callbacks installed above.
+void* operator new(std::size_t size)
+{
+    if (void* pointer = allocate(size))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* pointer = allocateAligned(size, alignment))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return ::operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /* tag */) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /* tag */) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& /* tag */) noexcept
+{
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& /* tag */) noexcept
+{
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /* size */) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /* size */) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t& /* tag */) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t& /* tag */) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /* alignment */) noexcept
+{
+    deallocateAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t /* alignment */) noexcept
+{
+    deallocateAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /* size */, std::align_val_t /* alignment */) noexcept
+{
+    deallocateAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /* size */, std::align_val_t /* alignment */) noexcept
+{
+    deallocateAligned(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /* alignment */, const std::nothrow_t& /* tag */) noexcept
+{
+    deallocateAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t /* alignment */, const std::nothrow_t& /* tag */) noexcept
+{
+    deallocateAligned(pointer);
+}
@@ -2,4 +2,29 @@
 
 #include <string>
 
+#include <cstddef>
+
 [[nodiscard]] std::string runAudioDeviceTests();
+
+// Forces the audio devices created during its lifetime onto miniaudio's null backend
+// (through sfml-audio's test hooks), so that playback and capture tests can run by
+// default without audio hardware. Construct it before any audio object.
+class NullAudioBackend
+{
+public:
+    NullAudioBackend();
+    ~NullAudioBackend();
+
+    NullAudioBackend(const NullAudioBackend&)            = delete;
+    NullAudioBackend& operator=(const NullAudioBackend&) = delete;
+
+private:
+    bool m_previouslyForced{};
+};
+
+// Allocations made through any form of the global operator new or by miniaudio
+// by threads flagged with markAudioThread() are counted while tracking is enabled.
+// This lets tests check that the real-time audio callbacks don't allocate.
+void                      markAudioThread();
+void                      startAudioThreadAllocationTracking();
+[[nodiscard]] std::size_t stopAudioThreadAllocationTracking();